@@ -1,5 +1,10 @@
 #include "catris.h"
 
+// the delta sprites stay in flash even when the sprites are in RAM
+static uint8_t deltaDataRead(uint8_t* addr) {
+	return pgm_read_byte(addr);
+}
+
 Catris::Catris(fontDataReader fontDataReader, spriteDataReader spriteDataReader):
 		_fontDataReader(fontDataReader), _spriteDataReader(spriteDataReader), _buffer(NULL) {
 
@@ -9,69 +14,74 @@ Catris::Catris(fontDataReader fontDataReader, spriteDataReader spriteDataReader)
 
 	_scrollText = new ScrollText(0, 14, 10, fontDataReader, (uint8_t*) font4x5);
 
+	_spriteClip.left = 0;
+	_spriteClip.top = 1;
+	_spriteClip.right = _spriteClip.left + CATRIS_SPRITE_WIDTH;
+	_spriteClip.bottom = _spriteClip.top + CATRIS_SPRITE_HEIGHT;
+
 	unsigned long delay = 150;
 	_happyAnimation = new Animation(12);
-	_happyAnimation->setFrame(0, delay, (uint8_t*) catrisHappy1LeftSprite);
-	_happyAnimation->setFrame(1, delay, (uint8_t*) catrisHappy2LeftSprite);
-	_happyAnimation->setFrame(2, delay, (uint8_t*) catrisHappy3LeftSprite);
-	_happyAnimation->setFrame(3, delay, (uint8_t*) catrisHappy1LeftSprite);
-	_happyAnimation->setFrame(4, delay, (uint8_t*) catrisHappy2LeftSprite);
-	_happyAnimation->setFrame(5, delay * 5, (uint8_t*) catrisHappy3LeftSprite);
-	_happyAnimation->setFrame(6, delay, (uint8_t*) catrisHappy3RightSprite);
-	_happyAnimation->setFrame(7, delay, (uint8_t*) catrisHappy2RightSprite);
-	_happyAnimation->setFrame(8, delay, (uint8_t*) catrisHappy1RightSprite);
-	_happyAnimation->setFrame(9, delay, (uint8_t*) catrisHappy3RightSprite);
-	_happyAnimation->setFrame(10, delay, (uint8_t*) catrisHappy2RightSprite);
-	_happyAnimation->setFrame(11, delay * 5, (uint8_t*) catrisHappy1RightSprite);
+	_happyAnimation->setFrame(0, delay, (uint8_t*) catrisHappy1LeftSprite, (uint8_t*) catrisHappy1RightToCatrisHappy1LeftDelta);
+	_happyAnimation->setFrame(1, delay, (uint8_t*) catrisHappy2LeftSprite, (uint8_t*) catrisHappy1LeftToCatrisHappy2LeftDelta);
+	_happyAnimation->setFrame(2, delay, (uint8_t*) catrisHappy3LeftSprite, (uint8_t*) catrisHappy2LeftToCatrisHappy3LeftDelta);
+	_happyAnimation->setFrame(3, delay, (uint8_t*) catrisHappy1LeftSprite, (uint8_t*) catrisHappy3LeftToCatrisHappy1LeftDelta);
+	_happyAnimation->setFrame(4, delay, (uint8_t*) catrisHappy2LeftSprite, (uint8_t*) catrisHappy1LeftToCatrisHappy2LeftDelta);
+	_happyAnimation->setFrame(5, delay * 5, (uint8_t*) catrisHappy3LeftSprite, (uint8_t*) catrisHappy2LeftToCatrisHappy3LeftDelta);
+	_happyAnimation->setFrame(6, delay, (uint8_t*) catrisHappy3RightSprite, (uint8_t*) catrisHappy3LeftToCatrisHappy3RightDelta);
+	_happyAnimation->setFrame(7, delay, (uint8_t*) catrisHappy2RightSprite, (uint8_t*) catrisHappy3RightToCatrisHappy2RightDelta);
+	_happyAnimation->setFrame(8, delay, (uint8_t*) catrisHappy1RightSprite, (uint8_t*) catrisHappy2RightToCatrisHappy1RightDelta);
+	_happyAnimation->setFrame(9, delay, (uint8_t*) catrisHappy3RightSprite, (uint8_t*) catrisHappy1RightToCatrisHappy3RightDelta);
+	_happyAnimation->setFrame(10, delay, (uint8_t*) catrisHappy2RightSprite, (uint8_t*) catrisHappy3RightToCatrisHappy2RightDelta);
+	_happyAnimation->setFrame(11, delay * 5, (uint8_t*) catrisHappy1RightSprite, (uint8_t*) catrisHappy2RightToCatrisHappy1RightDelta);
 
 	_shockedAnimation = new Animation(11);
-	_shockedAnimation->setFrame(0, 1000, (uint8_t*) catrisShocked1Sprite);
-	_shockedAnimation->setFrame(1, 50, (uint8_t*) catrisShocked2Sprite);
-	_shockedAnimation->setFrame(2, 100, (uint8_t*) catrisShocked3Sprite);
-	_shockedAnimation->setFrame(3, 50, (uint8_t*) catrisShocked2Sprite);
-	_shockedAnimation->setFrame(4, 2000, (uint8_t*) catrisShocked1Sprite);
-	_shockedAnimation->setFrame(5, 50, (uint8_t*) catrisShocked2Sprite);
-	_shockedAnimation->setFrame(6, 100, (uint8_t*) catrisShocked3Sprite);
-	_shockedAnimation->setFrame(7, 50, (uint8_t*) catrisShocked2Sprite);
-	_shockedAnimation->setFrame(8, 50, (uint8_t*) catrisShocked1Sprite);
-	_shockedAnimation->setFrame(9, 100, (uint8_t*) catrisShocked3Sprite);
-	_shockedAnimation->setFrame(10, 50, (uint8_t*) catrisShocked2Sprite);
+	_shockedAnimation->setFrame(0, 1000, (uint8_t*) catrisShocked1Sprite, (uint8_t*) catrisShocked2ToCatrisShocked1Delta);
+	_shockedAnimation->setFrame(1, 50, (uint8_t*) catrisShocked2Sprite, (uint8_t*) catrisShocked1ToCatrisShocked2Delta);
+	_shockedAnimation->setFrame(2, 100, (uint8_t*) catrisShocked3Sprite, (uint8_t*) catrisShocked2ToCatrisShocked3Delta);
+	_shockedAnimation->setFrame(3, 50, (uint8_t*) catrisShocked2Sprite, (uint8_t*) catrisShocked3ToCatrisShocked2Delta);
+	_shockedAnimation->setFrame(4, 2000, (uint8_t*) catrisShocked1Sprite, (uint8_t*) catrisShocked2ToCatrisShocked1Delta);
+	_shockedAnimation->setFrame(5, 50, (uint8_t*) catrisShocked2Sprite, (uint8_t*) catrisShocked1ToCatrisShocked2Delta);
+	_shockedAnimation->setFrame(6, 100, (uint8_t*) catrisShocked3Sprite, (uint8_t*) catrisShocked2ToCatrisShocked3Delta);
+	_shockedAnimation->setFrame(7, 50, (uint8_t*) catrisShocked2Sprite, (uint8_t*) catrisShocked3ToCatrisShocked2Delta);
+	_shockedAnimation->setFrame(8, 50, (uint8_t*) catrisShocked1Sprite, (uint8_t*) catrisShocked2ToCatrisShocked1Delta);
+	_shockedAnimation->setFrame(9, 100, (uint8_t*) catrisShocked3Sprite, (uint8_t*) catrisShocked1ToCatrisShocked3Delta);
+	_shockedAnimation->setFrame(10, 50, (uint8_t*) catrisShocked2Sprite, (uint8_t*) catrisShocked3ToCatrisShocked2Delta);
 
 	_worriedAnimation = new Animation(11);
-	_worriedAnimation->setFrame(0, delay, (uint8_t*) catrisWorried1Sprite);
-	_worriedAnimation->setFrame(1, delay, (uint8_t*) catrisWorried2Sprite);
-	_worriedAnimation->setFrame(2, delay, (uint8_t*) catrisWorried3Sprite);
-	_worriedAnimation->setFrame(3, delay, (uint8_t*) catrisWorried4Sprite);
-	_worriedAnimation->setFrame(4, delay, (uint8_t*) catrisWorried3Sprite);
-	_worriedAnimation->setFrame(5, delay, (uint8_t*) catrisWorried2Sprite);
-	_worriedAnimation->setFrame(6, delay, (uint8_t*) catrisWorried1Sprite);
-	_worriedAnimation->setFrame(7, delay, (uint8_t*) catrisWorried4Sprite);
-	_worriedAnimation->setFrame(8, delay, (uint8_t*) catrisWorried1Sprite);
-	_worriedAnimation->setFrame(9, delay, (uint8_t*) catrisWorried2Sprite);
-	_worriedAnimation->setFrame(10, delay, (uint8_t*) catrisWorried3Sprite);
+	_worriedAnimation->setFrame(0, delay, (uint8_t*) catrisWorried1Sprite, (uint8_t*) catrisWorried3ToCatrisWorried1Delta);
+	_worriedAnimation->setFrame(1, delay, (uint8_t*) catrisWorried2Sprite, (uint8_t*) catrisWorried1ToCatrisWorried2Delta);
+	_worriedAnimation->setFrame(2, delay, (uint8_t*) catrisWorried3Sprite, (uint8_t*) catrisWorried2ToCatrisWorried3Delta);
+	_worriedAnimation->setFrame(3, delay, (uint8_t*) catrisWorried4Sprite, (uint8_t*) catrisWorried3ToCatrisWorried4Delta);
+	_worriedAnimation->setFrame(4, delay, (uint8_t*) catrisWorried3Sprite, (uint8_t*) catrisWorried4ToCatrisWorried3Delta);
+	_worriedAnimation->setFrame(5, delay, (uint8_t*) catrisWorried2Sprite, (uint8_t*) catrisWorried3ToCatrisWorried2Delta);
+	_worriedAnimation->setFrame(6, delay, (uint8_t*) catrisWorried1Sprite, (uint8_t*) catrisWorried2ToCatrisWorried1Delta);
+	_worriedAnimation->setFrame(7, delay, (uint8_t*) catrisWorried4Sprite, (uint8_t*) catrisWorried1ToCatrisWorried4Delta);
+	_worriedAnimation->setFrame(8, delay, (uint8_t*) catrisWorried1Sprite, (uint8_t*) catrisWorried4ToCatrisWorried1Delta);
+	_worriedAnimation->setFrame(9, delay, (uint8_t*) catrisWorried2Sprite, (uint8_t*) catrisWorried1ToCatrisWorried2Delta);
+	_worriedAnimation->setFrame(10, delay, (uint8_t*) catrisWorried3Sprite, (uint8_t*) catrisWorried2ToCatrisWorried3Delta);
 
 	delay = 100;
 	_inLoveAnimation = new Animation(7);
-	_inLoveAnimation->setFrame(0, delay, (uint8_t*) catrisInLove1Sprite);
-	_inLoveAnimation->setFrame(1, delay, (uint8_t*) catrisInLove2Sprite);
-	_inLoveAnimation->setFrame(2, delay, (uint8_t*) catrisInLove3Sprite);
-	_inLoveAnimation->setFrame(3, delay, (uint8_t*) catrisInLove4Sprite);
-	_inLoveAnimation->setFrame(4, delay, (uint8_t*) catrisInLove3Sprite);
-	_inLoveAnimation->setFrame(5, delay, (uint8_t*) catrisInLove2Sprite);
-	_inLoveAnimation->setFrame(6, delay, (uint8_t*) catrisInLove1Sprite);
+	_inLoveAnimation->setFrame(0, delay, (uint8_t*) catrisInLove1Sprite, (uint8_t*) catrisInLove1ToCatrisInLove1Delta);
+	_inLoveAnimation->setFrame(1, delay, (uint8_t*) catrisInLove2Sprite, (uint8_t*) catrisInLove1ToCatrisInLove2Delta);
+	_inLoveAnimation->setFrame(2, delay, (uint8_t*) catrisInLove3Sprite, (uint8_t*) catrisInLove2ToCatrisInLove3Delta);
+	_inLoveAnimation->setFrame(3, delay, (uint8_t*) catrisInLove4Sprite, (uint8_t*) catrisInLove3ToCatrisInLove4Delta);
+	_inLoveAnimation->setFrame(4, delay, (uint8_t*) catrisInLove3Sprite, (uint8_t*) catrisInLove4ToCatrisInLove3Delta);
+	_inLoveAnimation->setFrame(5, delay, (uint8_t*) catrisInLove2Sprite, (uint8_t*) catrisInLove3ToCatrisInLove2Delta);
+	_inLoveAnimation->setFrame(6, delay, (uint8_t*) catrisInLove1Sprite, (uint8_t*) catrisInLove2ToCatrisInLove1Delta);
 
 	delay = 200;
 	_lowBatteryAnimation = new Animation(3);
-	_lowBatteryAnimation->setFrame(0, delay, (uint8_t*) lowBattery1Sprite);
-	_lowBatteryAnimation->setFrame(1, delay, (uint8_t*) lowBattery2Sprite);
-	_lowBatteryAnimation->setFrame(2, 2000, (uint8_t*) lowBattery3Sprite);
+	_lowBatteryAnimation->setFrame(0, delay, (uint8_t*) lowBattery1Sprite, (uint8_t*) lowBattery3ToLowBattery1Delta);
+	_lowBatteryAnimation->setFrame(1, delay, (uint8_t*) lowBattery2Sprite, (uint8_t*) lowBattery1ToLowBattery2Delta);
+	_lowBatteryAnimation->setFrame(2, 2000, (uint8_t*) lowBattery3Sprite, (uint8_t*) lowBattery2ToLowBattery3Delta);
 
 	delay = 100;
 	_highScoreAnimation = new Animation(4);
-	_highScoreAnimation->setFrame(0, 2000, (uint8_t*) highScore1Sprite);
-	_highScoreAnimation->setFrame(1, delay, (uint8_t*) highScore2Sprite);
-	_highScoreAnimation->setFrame(2, delay, (uint8_t*) highScore3Sprite);
-	_highScoreAnimation->setFrame(3, delay, (uint8_t*) highScore2Sprite);
+	_highScoreAnimation->setFrame(0, 2000, (uint8_t*) highScore1Sprite, (uint8_t*) highScore2ToHighScore1Delta);
+	_highScoreAnimation->setFrame(1, delay, (uint8_t*) highScore2Sprite, (uint8_t*) highScore1ToHighScore2Delta);
+	_highScoreAnimation->setFrame(2, delay, (uint8_t*) highScore3Sprite, (uint8_t*) highScore2ToHighScore3Delta);
+	_highScoreAnimation->setFrame(3, delay, (uint8_t*) highScore2Sprite, (uint8_t*) highScore3ToHighScore2Delta);
 
 	setAnimation(Anim::Happy);
 }
@@ -151,11 +161,15 @@ bool Catris::update() {
 	}
 }
 
-void Catris::draw(canvas canvas) {
-	_playAnimation(canvas);
+void Catris::invalidate() {
+	_redraw = true;
+}
+
+void Catris::draw(canvas canvas, rowsCanvas rowsCanvas) {
+	_playAnimation(canvas, rowsCanvas);
 
 	uint8_t color[3];
-	hsv2rgb(360 * _rainbowTimer->progress(true), 1, 1, color);
+	hsv2rgb8(_rainbowTimer->progress8(), 255, 255, color);
 
 	_scrollText->draw(canvas, color);
 }
@@ -164,19 +178,28 @@ void Catris::_loadAnimation(Animation* animation) {
 	_currentAnimation = animation;
 	_animFrame = 0;
 	_animTimer->reset(animation->getDuration(0));
+	_redraw = true;
 }
 
-void Catris::_playAnimation(canvas canvas) {
+void Catris::_playAnimation(canvas canvas, rowsCanvas rowsCanvas) {
 	if (_animTimer->fire()) {
 		_animFrame = _animFrame == _currentAnimation->frameCount - 1 ? 0 : _animFrame + 1;
 		_animTimer->reset(_currentAnimation->getDuration(_animFrame));
-	}
 
-	for (uint8_t x = 0; x < 10; ++x) {
-		for (uint8_t y = 1; y < 14; ++y) {
-			canvas(x, y, 0, 0, 0);
+		if (!_redraw) {
+			// the canvas still holds the previous frame, only apply the changes
+			blitSprite(canvas, &_spriteClip, spritePalette, &deltaDataRead, _currentAnimation->getDelta(_animFrame),
+					_spriteClip.left, _spriteClip.top, CATRIS_SPRITE_WIDTH, CATRIS_SPRITE_HEIGHT);
 		}
 	}
 
-	drawSprite(canvas, spritePalette, _spriteDataReader, _currentAnimation->getSprite(_animFrame), 0, 1);
+	if (_redraw) {
+		_redraw = false;
+
+		// the sprite spans the whole width of the screen
+		rowsCanvas(_spriteClip.top, _spriteClip.bottom, 0, 0, 0);
+
+		blitSprite(canvas, &_spriteClip, spritePalette, _spriteDataReader, _currentAnimation->getSprite(_animFrame),
+				_spriteClip.left, _spriteClip.top, CATRIS_SPRITE_WIDTH, CATRIS_SPRITE_HEIGHT);
+	}
 }
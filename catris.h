@@ -5,6 +5,10 @@
 #include "graphics.h"
 #include "font_data.h"
 #include "sprite_data.h"
+#include "sprite_delta_data.h"
+
+#define CATRIS_SPRITE_WIDTH  10
+#define CATRIS_SPRITE_HEIGHT 13
 
 class Catris {
 
@@ -29,7 +33,8 @@ public:
 	void setText(const char* text);
 	void setFormattedText(const char* format, ...);
 	bool update();
-	void draw(canvas canvas);
+	void invalidate();
+	void draw(canvas canvas, rowsCanvas rowsCanvas);
 
 private:
 
@@ -41,6 +46,7 @@ private:
 	Timer* _animTimer;
 
 	ScrollText* _scrollText;
+	ClipRect _spriteClip;
 	char* _buffer;
 
 	Anim _currentAnim;
@@ -54,9 +60,10 @@ private:
 	Animation* _highScoreAnimation;
 
 	uint8_t _animFrame;
+	bool _redraw;
 
 	void _loadAnimation(Animation* animation);
-	void _playAnimation(canvas canvas);
+	void _playAnimation(canvas canvas, rowsCanvas rowsCanvas);
 };
 
 #endif
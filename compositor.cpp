@@ -0,0 +1,340 @@
+#include "compositor.h"
+
+#define maskByte(i) (i >> 3)
+#define maskBit(i) (1 << (i & 0b111))
+
+// pixels held by the sparse layers, the others are dense
+static const uint8_t layerCapacity[COMPOSITOR_LAYER_COUNT] = {
+	0, // Background
+	0, // Pile
+	COMPOSITOR_GHOST_PIXELS,
+	COMPOSITOR_PIECE_PIXELS,
+	COMPOSITOR_PARTICLES_PIXELS,
+	0 // Overlay
+};
+
+Compositor::Compositor(uint8_t width, uint8_t height):
+		_width(width), _height(height), _selected(Background) {
+
+	_maskSize = (width * height + 7) / 8;
+	_stale = (uint8_t*) malloc(_maskSize);
+
+	for (uint8_t l = 0; l < COMPOSITOR_LAYER_COUNT; ++l) {
+		// layer buffers are allocated on first use
+		_layers[l].capacity = layerCapacity[l];
+		_layers[l].pixels = NULL;
+		_layers[l].palette = NULL;
+		_layers[l].paletteRefs = NULL;
+		_layers[l].sparse = NULL;
+		_layers[l].count = 0;
+		_layers[l].dirtyTop = height;
+		_layers[l].dirtyBottom = -1;
+	}
+
+	invalidate();
+}
+
+Compositor::~Compositor() {
+	free(_stale);
+
+	for (uint8_t l = 0; l < COMPOSITOR_LAYER_COUNT; ++l) {
+		free(_layers[l].pixels);
+		free(_layers[l].palette);
+		free(_layers[l].paletteRefs);
+		free(_layers[l].sparse);
+	}
+}
+
+void Compositor::begin(Layer layer) {
+	_Layer* l = &_layers[layer];
+
+	_selected = layer;
+
+	if (l->capacity > 0) {
+		if (l->sparse == NULL) {
+			l->sparse = (_Pixel*) malloc(l->capacity * sizeof(_Pixel));
+		}
+
+		// every entry is stale until its pixel gets drawn again
+		memset(_stale, 0, _maskSize);
+
+		for (uint8_t e = 0; e < l->count; ++e) {
+			_stale[maskByte(e)] |= maskBit(e);
+		}
+
+		return;
+	}
+
+	uint16_t count = _width * _height;
+
+	if (l->pixels == NULL) {
+		l->pixels = (uint8_t*) malloc((count + 1) / 2);
+		l->palette = (uint8_t (*)[3]) malloc(COMPOSITOR_PALETTE_SIZE * 3);
+		l->paletteRefs = (uint16_t*) malloc(COMPOSITOR_PALETTE_SIZE * sizeof(uint16_t));
+
+		memset(l->pixels, 0, (count + 1) / 2);
+		memset(l->palette, 0, COMPOSITOR_PALETTE_SIZE * 3);
+		memset(l->paletteRefs, 0, COMPOSITOR_PALETTE_SIZE * sizeof(uint16_t));
+	}
+
+	// every covered pixel is stale until it gets drawn again
+	for (uint16_t i = 0; i < count; ++i) {
+		if (_getIndex(l, i) != 0) {
+			_stale[maskByte(i)] |= maskBit(i);
+		} else {
+			_stale[maskByte(i)] &= ~maskBit(i);
+		}
+	}
+}
+
+void Compositor::set(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b) {
+	if (x < 0 || x >= _width || y < 0 || y >= _height) {
+		return;
+	}
+
+	_Layer* l = &_layers[_selected];
+
+	if (l->capacity > 0) {
+		_setSparse(l, x, y, r, g, b);
+	} else {
+		_setDense(l, x, y, r, g, b);
+	}
+}
+
+void Compositor::end() {
+	_Layer* l = &_layers[_selected];
+
+	if (l->capacity > 0) {
+		// drop entries which were not drawn again, the last one takes their place
+		for (uint8_t e = l->count; e-- > 0;) {
+			if (_stale[maskByte(e)] & maskBit(e)) {
+				_markDirty(l, l->sparse[e].y);
+				l->sparse[e] = l->sparse[--l->count];
+			}
+		}
+
+		return;
+	}
+
+	for (uint8_t m = 0; m < _maskSize; ++m) {
+		if (_stale[m] == 0) {
+			continue;
+		}
+
+		// uncover pixels which were not drawn again
+		for (uint8_t bit = 0; bit < 8; ++bit) {
+			if (_stale[m] & 1 << bit) {
+				uint16_t i = m * 8 + bit;
+
+				l->paletteRefs[_getIndex(l, i)]--;
+				_putIndex(l, i, 0);
+				_markDirty(l, i / _width);
+			}
+		}
+	}
+}
+
+void Compositor::clear(Layer layer) {
+	begin(layer);
+	end();
+}
+
+bool Compositor::isDirty(Layer layer) {
+	return _layers[layer].dirtyTop <= _layers[layer].dirtyBottom;
+}
+
+void Compositor::invalidate() {
+	_layers[Background].dirtyTop = 0;
+	_layers[Background].dirtyBottom = _height - 1;
+}
+
+bool Compositor::compose(canvas canvas) {
+	int8_t top = _height;
+	int8_t bottom = -1;
+
+	for (uint8_t l = 0; l < COMPOSITOR_LAYER_COUNT; ++l) {
+		if (isDirty(static_cast<Layer>(l))) {
+			if (_layers[l].dirtyTop < top) {
+				top = _layers[l].dirtyTop;
+			}
+
+			if (_layers[l].dirtyBottom > bottom) {
+				bottom = _layers[l].dirtyBottom;
+			}
+
+			_layers[l].dirtyTop = _height;
+			_layers[l].dirtyBottom = -1;
+		}
+	}
+
+	if (top > bottom) {
+		return false;
+	}
+
+	// re-composite only the rows touched by dirty layers, a row at a time
+	// from the bottom layer up, so that every pixel is written out once
+	uint8_t row[COMPOSITOR_MAX_WIDTH][3];
+
+	for (int8_t y = top; y <= bottom; ++y) {
+		memset(row, 0, sizeof(row));
+
+		for (uint8_t l = 0; l < COMPOSITOR_LAYER_COUNT; ++l) {
+			_Layer* layer = &_layers[l];
+
+			if (layer->sparse != NULL) {
+				for (uint8_t e = 0; e < layer->count; ++e) {
+					if (layer->sparse[e].y == y) {
+						memcpy(row[layer->sparse[e].x], layer->sparse[e].color, 3);
+					}
+				}
+			} else if (layer->pixels != NULL) {
+				for (uint8_t x = 0; x < _width; ++x) {
+					uint8_t index = _getIndex(layer, y * _width + x);
+
+					if (index != 0) {
+						memcpy(row[x], layer->palette[index], 3);
+					}
+				}
+			}
+		}
+
+		for (uint8_t x = 0; x < _width; ++x) {
+			canvas(x, y, row[x][0], row[x][1], row[x][2]);
+		}
+	}
+
+	return true;
+}
+
+void Compositor::_setDense(_Layer* layer, int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b) {
+	uint16_t i = y * _width + x;
+	uint8_t current = _getIndex(layer, i);
+
+	_stale[maskByte(i)] &= ~maskBit(i);
+
+	if (current != 0) {
+		uint8_t* color = layer->palette[current];
+
+		if (color[0] == r && color[1] == g && color[2] == b) {
+			return;
+		}
+
+		// release the current entry first so that it can be reassigned right away
+		layer->paletteRefs[current]--;
+	}
+
+	uint8_t index = _paletteIndex(layer, r, g, b);
+	layer->paletteRefs[index]++;
+
+	if (index == current) {
+		return;
+	}
+
+	_putIndex(layer, i, index);
+	_markDirty(layer, y);
+}
+
+void Compositor::_setSparse(_Layer* layer, int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b) {
+	uint8_t e = 0;
+
+	while (e < layer->count && (layer->sparse[e].x != x || layer->sparse[e].y != y)) {
+		++e;
+	}
+
+	if (e < layer->count) {
+		uint8_t* color = layer->sparse[e].color;
+
+		_stale[maskByte(e)] &= ~maskBit(e);
+
+		if (color[0] == r && color[1] == g && color[2] == b) {
+			return;
+		}
+	} else if (layer->count < layer->capacity) {
+		layer->count++;
+	} else {
+		// full, a moved pixel takes the place of one not drawn again yet
+		e = 0;
+
+		while (e < layer->count && !(_stale[maskByte(e)] & maskBit(e))) {
+			++e;
+		}
+
+		if (e == layer->count) {
+			return;
+		}
+
+		_stale[maskByte(e)] &= ~maskBit(e);
+		_markDirty(layer, layer->sparse[e].y);
+	}
+
+	layer->sparse[e].x = x;
+	layer->sparse[e].y = y;
+	layer->sparse[e].color[0] = r;
+	layer->sparse[e].color[1] = g;
+	layer->sparse[e].color[2] = b;
+
+	_markDirty(layer, y);
+}
+
+uint8_t Compositor::_getIndex(_Layer* layer, uint16_t i) {
+	uint8_t pixels = layer->pixels[i / 2];
+
+	return i % 2 == 0 ? pixels >> 4 : pixels & 0b1111;
+}
+
+void Compositor::_putIndex(_Layer* layer, uint16_t i, uint8_t index) {
+	uint8_t* pixels = &layer->pixels[i / 2];
+
+	*pixels = i % 2 == 0 ? (index << 4) | (*pixels & 0b1111) : (*pixels & 0b11110000) | index;
+}
+
+uint8_t Compositor::_paletteIndex(_Layer* layer, uint8_t r, uint8_t g, uint8_t b) {
+	uint8_t unused = COMPOSITOR_PALETTE_SIZE;
+
+	// entry 0 marks uncovered pixels
+	for (uint8_t p = 1; p < COMPOSITOR_PALETTE_SIZE; ++p) {
+		uint8_t* color = layer->palette[p];
+
+		if (color[0] == r && color[1] == g && color[2] == b) {
+			return p;
+		}
+
+		if (unused == COMPOSITOR_PALETTE_SIZE && layer->paletteRefs[p] == 0) {
+			unused = p;
+		}
+	}
+
+	if (unused < COMPOSITOR_PALETTE_SIZE) {
+		layer->palette[unused][0] = r;
+		layer->palette[unused][1] = g;
+		layer->palette[unused][2] = b;
+
+		return unused;
+	}
+
+	// palette is full, fall back to the nearest color
+	uint8_t nearest = 1;
+	uint16_t nearestDistance = 0xffff;
+
+	for (uint8_t p = 1; p < COMPOSITOR_PALETTE_SIZE; ++p) {
+		uint8_t* color = layer->palette[p];
+		uint16_t distance = abs(color[0] - r) + abs(color[1] - g) + abs(color[2] - b);
+
+		if (distance < nearestDistance) {
+			nearest = p;
+			nearestDistance = distance;
+		}
+	}
+
+	return nearest;
+}
+
+void Compositor::_markDirty(_Layer* layer, int8_t y) {
+	if (y < layer->dirtyTop) {
+		layer->dirtyTop = y;
+	}
+
+	if (y > layer->dirtyBottom) {
+		layer->dirtyBottom = y;
+	}
+}
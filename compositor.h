@@ -0,0 +1,85 @@
+#ifndef __COMPOSITOR_H
+#define __COMPOSITOR_H
+
+#include <stdlib.h>
+#include <inttypes.h>
+#include <string.h>
+#include "graphics.h"
+
+#define COMPOSITOR_LAYER_COUNT 6
+
+// widest canvas compose() can blend a row of
+#define COMPOSITOR_MAX_WIDTH 10
+
+// Dense layers store 4 bits per pixel with a palette of 15 colors, index 0
+// leaves the pixel uncovered. Beyond 15 colors the nearest one is used.
+#define COMPOSITOR_PALETTE_SIZE 16
+
+// Sparse layers hold a short list of pixels instead, further pixels drawn
+// between begin() and end() are dropped. A tetromino covers 4 pixels, the
+// particles at most PARTICLE_POOL_SIZE.
+#define COMPOSITOR_GHOST_PIXELS     4
+#define COMPOSITOR_PIECE_PIXELS     4
+#define COMPOSITOR_PARTICLES_PIXELS 48
+
+class Compositor {
+
+public:
+
+	// layers in bottom to top order
+	enum Layer {
+		Background,
+		Pile,
+		Ghost,
+		Piece,
+		Particles,
+		Overlay
+	};
+
+	Compositor(uint8_t width, uint8_t height);
+
+	~Compositor();
+
+	void begin(Layer layer);
+	void set(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b);
+	void end();
+	void clear(Layer layer);
+	bool isDirty(Layer layer);
+	void invalidate();
+	bool compose(canvas canvas);
+
+private:
+
+	struct _Pixel {
+		int8_t x;
+		int8_t y;
+		uint8_t color[3];
+	};
+
+	struct _Layer {
+		uint8_t capacity; // pixels of a sparse layer, 0 if dense
+		uint8_t* pixels; // dense: two palette indices per byte, high nibble first
+		uint8_t (*palette)[3];
+		uint16_t* paletteRefs;
+		_Pixel* sparse; // sparse: drawn pixels, stale ones flagged in _stale
+		uint8_t count;
+		int8_t dirtyTop;
+		int8_t dirtyBottom;
+	};
+
+	uint8_t _width;
+	uint8_t _height;
+	uint8_t _maskSize;
+	uint8_t* _stale; // pixels (dense) or entries (sparse) of the selected layer not redrawn since begin()
+	_Layer _layers[COMPOSITOR_LAYER_COUNT];
+	Layer _selected;
+
+	void _setDense(_Layer* layer, int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b);
+	void _setSparse(_Layer* layer, int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b);
+	uint8_t _getIndex(_Layer* layer, uint16_t i);
+	void _putIndex(_Layer* layer, uint16_t i, uint8_t index);
+	uint8_t _paletteIndex(_Layer* layer, uint8_t r, uint8_t g, uint8_t b);
+	void _markDirty(_Layer* layer, int8_t y);
+};
+
+#endif
@@ -0,0 +1,66 @@
+#include "display.h"
+
+Display::Display(): _width(0), _height(0), _chunkedLeds(NULL), _chunkedBrightness(0), _chunkedNext(0) {}
+
+Display::~Display() {}
+
+void Display::begin(uint8_t width, uint8_t height) {
+	_width = width;
+	_height = height;
+}
+
+void Display::show(const CRGB* leds, uint8_t brightness) {
+	uint16_t count = getLedCount();
+
+	startFrame();
+
+	for (uint16_t i = 0; i < count; ++i) {
+		writePixel(scale8(leds[i].r, brightness), scale8(leds[i].g, brightness), scale8(leds[i].b, brightness));
+	}
+
+	endFrame();
+}
+
+void Display::showChunked(const CRGB* leds, uint8_t brightness) {
+	_chunkedLeds = leds;
+	_chunkedBrightness = brightness;
+	_chunkedNext = 0;
+
+	startFrame();
+}
+
+void Display::update(uint16_t maxPixels) {
+	if (_chunkedLeds == NULL) {
+		return;
+	}
+
+	uint16_t count = getLedCount();
+	uint16_t end = count - _chunkedNext > maxPixels ? _chunkedNext + maxPixels : count;
+
+	for (uint16_t i = _chunkedNext; i < end; ++i) {
+		writePixel(scale8(_chunkedLeds[i].r, _chunkedBrightness), scale8(_chunkedLeds[i].g, _chunkedBrightness), scale8(_chunkedLeds[i].b, _chunkedBrightness));
+	}
+
+	_chunkedNext = end;
+
+	if (end == count) {
+		endFrame();
+		_chunkedLeds = NULL;
+	}
+}
+
+bool Display::isBusy() {
+	return _chunkedLeds != NULL;
+}
+
+uint8_t Display::getWidth() {
+	return _width;
+}
+
+uint8_t Display::getHeight() {
+	return _height;
+}
+
+uint16_t Display::getLedCount() {
+	return _width * _height;
+}
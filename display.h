@@ -0,0 +1,48 @@
+#ifndef __DISPLAY_H
+#define __DISPLAY_H
+
+#include <inttypes.h>
+#include <FastLED.h>
+
+// Output device behind the frame buffer. Pixels arrive in LED order, either as
+// a whole true-color buffer with the brightness to apply, or one by one
+// between startFrame() and endFrame() with the brightness already applied.
+// A whole buffer can also be written out a few pixels per update() call, so
+// that the main loop keeps running while the frame is sent.
+class Display {
+
+public:
+
+	Display();
+
+	virtual ~Display();
+
+	virtual void begin(uint8_t width, uint8_t height);
+	virtual void show(const CRGB* leds, uint8_t brightness);
+	// the buffer must not change until isBusy() returns false
+	void showChunked(const CRGB* leds, uint8_t brightness);
+	void update(uint16_t maxPixels);
+	virtual void startFrame() = 0;
+	virtual void writePixel(uint8_t r, uint8_t g, uint8_t b) = 0;
+	virtual void endFrame() = 0;
+
+	// a busy display cannot take the next frame yet
+	bool isBusy();
+
+	uint8_t getWidth();
+	uint8_t getHeight();
+	uint16_t getLedCount();
+
+protected:
+
+	uint8_t _width;
+	uint8_t _height;
+
+private:
+
+	const CRGB* _chunkedLeds; // frame being written by update(), NULL if none
+	uint8_t _chunkedBrightness;
+	uint16_t _chunkedNext;
+};
+
+#endif
@@ -0,0 +1,23 @@
+#include "fastled_display.h"
+
+FastLEDDisplay::FastLEDDisplay(): _controller(NULL) {}
+
+void FastLEDDisplay::setController(CLEDController* controller) {
+	_controller = controller;
+}
+
+void FastLEDDisplay::show(const CRGB* leds, uint8_t brightness) {
+	if (_controller == NULL) {
+		return;
+	}
+
+	_controller->setLeds((CRGB*) leds, getLedCount());
+	_controller->showLeds(brightness);
+}
+
+// FastLED needs the whole frame in memory, streamed pixels are dropped
+void FastLEDDisplay::startFrame() {}
+
+void FastLEDDisplay::writePixel(uint8_t r, uint8_t g, uint8_t b) {}
+
+void FastLEDDisplay::endFrame() {}
@@ -0,0 +1,25 @@
+#ifndef __FASTLED_DISPLAY_H
+#define __FASTLED_DISPLAY_H
+
+#include "display.h"
+
+// Drives the LEDs through a FastLED controller, which has to be set up with
+// FastLED.addLeds() first. Frames can only be shown as a whole.
+class FastLEDDisplay: public Display {
+
+public:
+
+	FastLEDDisplay();
+
+	void setController(CLEDController* controller);
+	void show(const CRGB* leds, uint8_t brightness);
+	void startFrame();
+	void writePixel(uint8_t r, uint8_t g, uint8_t b);
+	void endFrame();
+
+private:
+
+	CLEDController* _controller;
+};
+
+#endif
@@ -0,0 +1,107 @@
+#include "frame_scheduler.h"
+
+FrameScheduler::FrameScheduler(uint8_t fps): _inFrame(false) {
+	setFps(fps);
+	resetStats();
+}
+
+void FrameScheduler::setFps(uint8_t fps) {
+	_fps = fps > 0 ? fps : 1;
+	_period = 1000000UL / _fps;
+	_deadline = _micros() + _period;
+}
+
+uint8_t FrameScheduler::getFps() {
+	return _fps;
+}
+
+uint32_t FrameScheduler::getPeriod() {
+	return _period;
+}
+
+bool FrameScheduler::due() {
+	uint32_t now = _micros();
+
+	// wrap-around safe comparison with the deadline
+	if ((int32_t) (now - _deadline) < 0) {
+		return false;
+	}
+
+	uint32_t late = now - _deadline;
+	_jitterHistogram[_bucket(late)]++;
+
+	if (late >= _period) {
+		// whole frames were skipped, start a new cadence from now on
+		uint32_t skipped = late / _period;
+		_missedHistogram[skipped < FRAME_MISSED_BUCKETS ? skipped - 1 : FRAME_MISSED_BUCKETS - 1]++;
+
+		_deadline = now + _period;
+	} else {
+		_deadline += _period;
+	}
+
+	_frameStart = now;
+	_inFrame = true;
+
+	return true;
+}
+
+void FrameScheduler::frameDone() {
+	if (!_inFrame) {
+		return;
+	}
+
+	_inFrame = false;
+
+	uint32_t frameTime = _micros() - _frameStart;
+
+	_frames++;
+	_frameTimeHistogram[_bucket(frameTime)]++;
+
+	if (frameTime > _maxFrameTime) {
+		_maxFrameTime = frameTime;
+	}
+}
+
+uint32_t FrameScheduler::getFrames() {
+	return _frames;
+}
+
+uint32_t FrameScheduler::getMaxFrameTime() {
+	return _maxFrameTime;
+}
+
+const uint16_t* FrameScheduler::getFrameTimeHistogram() {
+	return _frameTimeHistogram;
+}
+
+const uint16_t* FrameScheduler::getJitterHistogram() {
+	return _jitterHistogram;
+}
+
+const uint16_t* FrameScheduler::getMissedHistogram() {
+	return _missedHistogram;
+}
+
+uint32_t FrameScheduler::getHistogramBucketLimit(uint8_t bucket) {
+	return (uint32_t) FRAME_HISTOGRAM_BASE_US << bucket;
+}
+
+void FrameScheduler::resetStats() {
+	_frames = 0;
+	_maxFrameTime = 0;
+
+	memset(_frameTimeHistogram, 0, sizeof(_frameTimeHistogram));
+	memset(_jitterHistogram, 0, sizeof(_jitterHistogram));
+	memset(_missedHistogram, 0, sizeof(_missedHistogram));
+}
+
+uint8_t FrameScheduler::_bucket(uint32_t duration) {
+	uint8_t bucket = 0;
+
+	while (bucket < FRAME_HISTOGRAM_BUCKETS - 1 && duration >= getHistogramBucketLimit(bucket)) {
+		bucket++;
+	}
+
+	return bucket;
+}
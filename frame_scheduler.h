@@ -0,0 +1,53 @@
+#ifndef __FRAME_SCHEDULER_H
+#define __FRAME_SCHEDULER_H
+
+#include <inttypes.h>
+#include <string.h>
+
+// Histograms use power-of-two buckets, the first one holds durations below
+// FRAME_HISTOGRAM_BASE_US, the last one everything from the upper limit of
+// the previous bucket upwards.
+#define FRAME_HISTOGRAM_BUCKETS 8
+#define FRAME_HISTOGRAM_BASE_US 512
+
+// the last missed deadline bucket counts this many or more dropped frames
+#define FRAME_MISSED_BUCKETS 4
+
+class FrameScheduler {
+
+public:
+
+	FrameScheduler(uint8_t fps);
+
+	void setFps(uint8_t fps);
+	uint8_t getFps();
+	uint32_t getPeriod();
+	bool due();
+	void frameDone();
+	uint32_t getFrames();
+	uint32_t getMaxFrameTime();
+	const uint16_t* getFrameTimeHistogram();
+	const uint16_t* getJitterHistogram();
+	const uint16_t* getMissedHistogram();
+	uint32_t getHistogramBucketLimit(uint8_t bucket);
+	void resetStats();
+
+private:
+
+	uint8_t _fps;
+	uint32_t _period; // in microseconds
+	uint32_t _deadline; // start of the next frame
+	uint32_t _frameStart;
+	bool _inFrame;
+
+	uint32_t _frames;
+	uint32_t _maxFrameTime;
+	uint16_t _frameTimeHistogram[FRAME_HISTOGRAM_BUCKETS]; // start of the frame to frameDone()
+	uint16_t _jitterHistogram[FRAME_HISTOGRAM_BUCKETS]; // delay of the frame start after its deadline
+	uint16_t _missedHistogram[FRAME_MISSED_BUCKETS]; // 1, 2, 3, 4+ deadlines skipped at once
+
+	uint8_t _bucket(uint32_t duration);
+	unsigned long _micros();
+};
+
+#endif
@@ -0,0 +1,475 @@
+#include "framebuffer.h"
+
+#ifdef FRAMEBUFFER_GAMMA
+static const uint8_t PROGMEM gammaTable[256] = {
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+		  3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+		  6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+		 12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+		 20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+		 30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+		 42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+		 56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+		 73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+		 91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+		113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+		137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+		163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+		192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+		223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255
+};
+#endif
+
+FrameBuffer::FrameBuffer(uint8_t width, uint8_t height):
+		_width(width), _height(height), _brightness(255), _powerBudget(0),
+		_limitedBrightness(255), _estimatedCurrent(0),
+		_framesPresented(0), _framesSkipped(0), _framesDeferred(0), _display(NULL) {
+
+	uint16_t count = width * height;
+
+#ifdef FRAMEBUFFER_INDEXED
+	_pixels = (uint8_t*) malloc(count / 2 + count % 2);
+	memset(_pixels, 0, count / 2 + count % 2);
+	memset(_palette, 0, sizeof(_palette));
+	memset(_paletteRefs, 0, sizeof(_paletteRefs));
+
+	// every pixel starts out black
+	_paletteRefs[0] = count;
+#else
+	_leds = (CRGB*) malloc(sizeof(CRGB) * count);
+	memset(_leds, 0, sizeof(CRGB) * count);
+	_channelSum = 0;
+#ifdef FRAMEBUFFER_ASYNC
+	_front = (CRGB*) malloc(sizeof(CRGB) * count);
+#endif
+#endif
+
+	invalidate();
+}
+
+FrameBuffer::~FrameBuffer() {
+#ifdef FRAMEBUFFER_INDEXED
+	free(_pixels);
+#else
+	free(_leds);
+#ifdef FRAMEBUFFER_ASYNC
+	free(_front);
+#endif
+#endif
+}
+
+void FrameBuffer::begin(Display* display) {
+	_display = display;
+	_display->begin(_width, _height);
+
+	invalidate();
+}
+
+uint8_t FrameBuffer::getWidth() {
+	return _width;
+}
+
+uint8_t FrameBuffer::getHeight() {
+	return _height;
+}
+
+#ifndef FRAMEBUFFER_INDEXED
+CRGB* FrameBuffer::getLeds() {
+	return _leds;
+}
+#endif
+
+void FrameBuffer::setBrightness(uint8_t brightness) {
+	_brightness = brightness;
+
+	invalidate();
+}
+
+void FrameBuffer::setPowerBudget(uint16_t milliamps) {
+	if (_powerBudget != milliamps) {
+		_powerBudget = milliamps;
+
+		invalidate();
+	}
+}
+
+uint8_t FrameBuffer::getLimitedBrightness() {
+	return _limitedBrightness;
+}
+
+uint16_t FrameBuffer::getEstimatedCurrent() {
+	return _estimatedCurrent;
+}
+
+void FrameBuffer::set(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b) {
+	if (x < 0 || x >= _width || y < 0 || y >= _height) {
+		return;
+	}
+
+	setUnchecked(x, y, r, g, b);
+}
+
+void FrameBuffer::setUnchecked(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b) {
+	// the caller guarantees that the pixel lies inside the buffer
+#ifdef FRAMEBUFFER_GAMMA
+	r = pgm_read_byte(gammaTable + r);
+	g = pgm_read_byte(gammaTable + g);
+	b = pgm_read_byte(gammaTable + b);
+#endif
+
+	_put(x, y, r, g, b);
+}
+
+void FrameBuffer::encode(uint8_t* buffer, int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b) {
+	if (x < 0 || x >= _width || y < 0 || y >= _height) {
+		return;
+	}
+
+#ifdef FRAMEBUFFER_GAMMA
+	r = pgm_read_byte(gammaTable + r);
+	g = pgm_read_byte(gammaTable + g);
+	b = pgm_read_byte(gammaTable + b);
+#endif
+
+	uint8_t* pixel = buffer + _ledIndex(x, y) * 3;
+
+	pixel[0] = r;
+	pixel[1] = g;
+	pixel[2] = b;
+}
+
+void FrameBuffer::blend(const uint8_t* to, uint16_t pixels, uint8_t fraction) {
+	if (pixels == 0) {
+		return;
+	}
+
+#ifdef FRAMEBUFFER_INDEXED
+	for (uint16_t i = 0; i < pixels; ++i, to += 3) {
+		int8_t y = i / _width;
+		int8_t x = y % 2 == 0 ? i % _width : _width - i % _width - 1;
+		const uint8_t* color = _palette[i % 2 == 0 ? _pixels[i / 2] >> 4 : _pixels[i / 2] & 0b1111];
+
+		_put(x, y, lerpQ8(color[0], to[0], fraction), lerpQ8(color[1], to[1], fraction), lerpQ8(color[2], to[2], fraction));
+	}
+#else
+	uint8_t* leds = (uint8_t*) _leds;
+	uint16_t size = _width * _height * 3;
+
+	fbBlend(leds, leds, to, pixels * 3, fraction);
+
+	// cheaper to sum up again than to track per pixel
+	_channelSum = 0;
+
+	for (uint16_t i = 0; i < size; ++i) {
+		_channelSum += leds[i];
+	}
+
+	// whole rows, the pixels run back and forth
+	_markDirty(0, 0);
+	_markDirty(_width - 1, (pixels - 1) / _width);
+#endif
+}
+
+void FrameBuffer::fill(uint8_t r, uint8_t g, uint8_t b) {
+	uint16_t count = _width * _height;
+
+#ifdef FRAMEBUFFER_GAMMA
+	r = pgm_read_byte(gammaTable + r);
+	g = pgm_read_byte(gammaTable + g);
+	b = pgm_read_byte(gammaTable + b);
+#endif
+
+#ifdef FRAMEBUFFER_INDEXED
+	// a single palette entry covers the whole screen
+	memset(_pixels, 0, count / 2 + count % 2);
+	memset(_paletteRefs, 0, sizeof(_paletteRefs));
+
+	_palette[0][0] = r;
+	_palette[0][1] = g;
+	_palette[0][2] = b;
+	_paletteRefs[0] = count;
+#else
+	fbFill((uint8_t*) _leds, count, r, g, b);
+	_channelSum = (uint32_t) count * (r + g + b);
+#endif
+
+	invalidate();
+}
+
+void FrameBuffer::fillRows(int8_t top, int8_t bottom, uint8_t r, uint8_t g, uint8_t b) {
+	top = top < 0 ? 0 : top;
+	bottom = bottom > _height ? _height : bottom;
+
+	if (top >= bottom) {
+		return;
+	}
+
+#ifdef FRAMEBUFFER_GAMMA
+	r = pgm_read_byte(gammaTable + r);
+	g = pgm_read_byte(gammaTable + g);
+	b = pgm_read_byte(gammaTable + b);
+#endif
+
+#ifdef FRAMEBUFFER_INDEXED
+	for (int8_t y = top; y < bottom; ++y) {
+		for (int8_t x = 0; x < _width; ++x) {
+			_put(x, y, r, g, b);
+		}
+	}
+#else
+	// whole rows are contiguous whichever way they run
+	uint8_t* start = (uint8_t*) &_leds[top * _width];
+	uint16_t count = (bottom - top) * _width;
+
+	for (uint16_t i = 0; i < count * 3; ++i) {
+		_channelSum -= start[i];
+	}
+
+	fbFill(start, count, r, g, b);
+	_channelSum += (uint32_t) count * (r + g + b);
+
+	_markDirty(0, top);
+	_markDirty(_width - 1, bottom - 1);
+#endif
+}
+
+void FrameBuffer::encodeRows(uint8_t* buffer, int8_t top, int8_t bottom, uint8_t r, uint8_t g, uint8_t b) {
+	top = top < 0 ? 0 : top;
+	bottom = bottom > _height ? _height : bottom;
+
+	if (top >= bottom) {
+		return;
+	}
+
+#ifdef FRAMEBUFFER_GAMMA
+	r = pgm_read_byte(gammaTable + r);
+	g = pgm_read_byte(gammaTable + g);
+	b = pgm_read_byte(gammaTable + b);
+#endif
+
+	fbFill(buffer + top * _width * 3, (bottom - top) * _width, r, g, b);
+}
+
+void FrameBuffer::invalidate() {
+	_dirty.left = 0;
+	_dirty.top = 0;
+	_dirty.right = _width - 1;
+	_dirty.bottom = _height - 1;
+}
+
+bool FrameBuffer::isDirty() {
+	return _dirty.left <= _dirty.right;
+}
+
+bool FrameBuffer::present() {
+	if (!isDirty()) {
+		_framesSkipped++;
+		return false;
+	}
+
+	if (_display->isBusy()) {
+		// keep the frame dirty, it goes out with the next present()
+		_framesDeferred++;
+		return false;
+	}
+
+	_limitPower();
+
+#ifdef FRAMEBUFFER_INDEXED
+	// expand the palette once, the pixels are only looked up while streaming
+	uint8_t palette[FRAMEBUFFER_PALETTE_SIZE][3];
+
+	for (uint8_t p = 0; p < FRAMEBUFFER_PALETTE_SIZE; ++p) {
+		for (uint8_t c = 0; c < 3; ++c) {
+			palette[p][c] = scale8(_palette[p][c], _limitedBrightness);
+		}
+	}
+
+	uint16_t count = _width * _height;
+
+	_display->startFrame();
+
+	for (uint16_t i = 0; i < count; ++i) {
+		uint8_t index = i % 2 == 0 ? _pixels[i / 2] >> 4 : _pixels[i / 2] & 0b1111;
+		_display->writePixel(palette[index][0], palette[index][1], palette[index][2]);
+	}
+
+	_display->endFrame();
+#elif defined(FRAMEBUFFER_ASYNC)
+	// _leds is free to change again as soon as the snapshot is taken
+	memcpy(_front, _leds, sizeof(CRGB) * _width * _height);
+	_display->showChunked(_front, _limitedBrightness);
+	_display->update(FRAMEBUFFER_ASYNC_CHUNK);
+#else
+	_display->show(_leds, _limitedBrightness);
+#endif
+
+	_framesPresented++;
+	_clean();
+
+	return true;
+}
+
+void FrameBuffer::update() {
+	_display->update(FRAMEBUFFER_ASYNC_CHUNK);
+}
+
+uint32_t FrameBuffer::getFramesPresented() {
+	return _framesPresented;
+}
+
+uint32_t FrameBuffer::getFramesSkipped() {
+	return _framesSkipped;
+}
+
+uint32_t FrameBuffer::getFramesDeferred() {
+	return _framesDeferred;
+}
+
+#ifdef FRAMEBUFFER_INDEXED
+uint8_t FrameBuffer::_paletteIndex(uint8_t r, uint8_t g, uint8_t b) {
+	uint8_t unused = FRAMEBUFFER_PALETTE_SIZE;
+
+	for (uint8_t p = 0; p < FRAMEBUFFER_PALETTE_SIZE; ++p) {
+		uint8_t* color = _palette[p];
+
+		if (color[0] == r && color[1] == g && color[2] == b) {
+			return p;
+		}
+
+		if (unused == FRAMEBUFFER_PALETTE_SIZE && _paletteRefs[p] == 0) {
+			unused = p;
+		}
+	}
+
+	if (unused < FRAMEBUFFER_PALETTE_SIZE) {
+		_palette[unused][0] = r;
+		_palette[unused][1] = g;
+		_palette[unused][2] = b;
+
+		return unused;
+	}
+
+	// palette is full, fall back to the nearest color
+	uint8_t nearest = 0;
+	uint16_t nearestDistance = 0xffff;
+
+	for (uint8_t p = 0; p < FRAMEBUFFER_PALETTE_SIZE; ++p) {
+		uint8_t* color = _palette[p];
+		uint16_t distance = abs(color[0] - r) + abs(color[1] - g) + abs(color[2] - b);
+
+		if (distance < nearestDistance) {
+			nearest = p;
+			nearestDistance = distance;
+		}
+	}
+
+	return nearest;
+}
+#endif
+
+uint32_t FrameBuffer::_getChannelSum() {
+#ifdef FRAMEBUFFER_INDEXED
+	uint32_t sum = 0;
+
+	for (uint8_t p = 0; p < FRAMEBUFFER_PALETTE_SIZE; ++p) {
+		if (_paletteRefs[p] > 0) {
+			sum += (uint32_t) _paletteRefs[p] * (_palette[p][0] + _palette[p][1] + _palette[p][2]);
+		}
+	}
+
+	return sum;
+#else
+	return _channelSum;
+#endif
+}
+
+void FrameBuffer::_limitPower() {
+	uint16_t count = _width * _height;
+	uint32_t idle = (uint32_t) count * FRAMEBUFFER_LED_IDLE_UA / 1000;
+
+	// channel current at the configured brightness, in 1/65025 mA units
+	uint32_t full = _getChannelSum() * FRAMEBUFFER_CHANNEL_MA;
+	uint32_t current = idle + full * _brightness / 65025;
+
+	_limitedBrightness = _brightness;
+
+	if (_powerBudget > 0 && current > _powerBudget && full > 0) {
+		uint32_t available = _powerBudget > idle ? _powerBudget - idle : 0;
+		uint32_t brightness = available * 65025 / full;
+
+		if (brightness < _limitedBrightness) {
+			_limitedBrightness = brightness;
+		}
+
+		current = idle + full * _limitedBrightness / 65025;
+	}
+
+	_estimatedCurrent = current;
+}
+
+void FrameBuffer::_put(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b) {
+	uint16_t i = _ledIndex(x, y);
+
+#ifdef FRAMEBUFFER_INDEXED
+	uint8_t* pixel = &_pixels[i / 2];
+	uint8_t current = i % 2 == 0 ? *pixel >> 4 : *pixel & 0b1111;
+	uint8_t* color = _palette[current];
+
+	if (color[0] == r && color[1] == g && color[2] == b) {
+		return;
+	}
+
+	// release the current entry first so that it can be reassigned right away
+	_paletteRefs[current]--;
+
+	// the index may stay the same if the released entry got reassigned
+	uint8_t index = _paletteIndex(r, g, b);
+	_paletteRefs[index]++;
+
+	*pixel = i % 2 == 0 ? (index << 4) | (*pixel & 0b1111) : (*pixel & 0b11110000) | index;
+#else
+	CRGB* led = &_leds[i];
+
+	if (led->r == r && led->g == g && led->b == b) {
+		return;
+	}
+
+	_channelSum += (int16_t) (r + g + b) - (int16_t) (led->r + led->g + led->b);
+
+	led->setRGB(r, g, b);
+#endif
+
+	_markDirty(x, y);
+}
+
+uint16_t FrameBuffer::_ledIndex(int8_t x, int8_t y) {
+	// every other row runs backwards on the LED strip
+	return y * _width + (y % 2 == 0 ? x : _width - x - 1);
+}
+
+void FrameBuffer::_markDirty(int8_t x, int8_t y) {
+	if (x < _dirty.left) {
+		_dirty.left = x;
+	}
+
+	if (x > _dirty.right) {
+		_dirty.right = x;
+	}
+
+	if (y < _dirty.top) {
+		_dirty.top = y;
+	}
+
+	if (y > _dirty.bottom) {
+		_dirty.bottom = y;
+	}
+}
+
+void FrameBuffer::_clean() {
+	_dirty.left = _width;
+	_dirty.top = _height;
+	_dirty.right = -1;
+	_dirty.bottom = -1;
+}
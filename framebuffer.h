@@ -0,0 +1,124 @@
+#ifndef __FRAMEBUFFER_H
+#define __FRAMEBUFFER_H
+
+#include <inttypes.h>
+#include <FastLED.h>
+#include "framebuffer_ops.h"
+#include "display.h"
+
+// Stores 4 bits per pixel and a dynamic palette of 16 colors instead of
+// a true-color CRGB array. Palette entries are reference counted and
+// reassigned to new colors as soon as no pixel uses them, so any color can
+// be shown as long as there are at most 16 of them on the screen at once.
+// Beyond that the nearest palette color is used.
+//#define FRAMEBUFFER_INDEXED
+
+#define FRAMEBUFFER_PALETTE_SIZE 16
+
+// Stores every color through a precomputed gamma 2.2 table, so the
+// framebuffer always holds the values sent to the LEDs.
+#define FRAMEBUFFER_GAMMA
+
+// LED current model used by the power limiter: quiescent current of one
+// LED and the current of one color channel at full value and brightness
+#define FRAMEBUFFER_LED_IDLE_UA 700
+#define FRAMEBUFFER_CHANNEL_MA   20
+
+// Writes true-color frames to the LEDs a chunk of FRAMEBUFFER_ASYNC_CHUNK
+// pixels per update() instead of blocking in FastLED.show() for the whole
+// frame, so that the audio can be refilled in between. The frame is copied to
+// a second buffer first, which costs another 3 bytes per LED. Frames presented
+// while the previous one is still being written are deferred.
+//#define FRAMEBUFFER_ASYNC
+#define FRAMEBUFFER_ASYNC_CHUNK 50
+
+#if defined(FRAMEBUFFER_INDEXED) && defined(FRAMEBUFFER_ASYNC)
+#error FRAMEBUFFER_ASYNC requires true-color mode
+#endif
+
+// both modes need the LedStream display instead of FastLED
+#if defined(FRAMEBUFFER_INDEXED) || defined(FRAMEBUFFER_ASYNC)
+#define FRAMEBUFFER_LED_STREAM
+#endif
+
+class FrameBuffer {
+
+public:
+
+	FrameBuffer(uint8_t width, uint8_t height);
+
+	~FrameBuffer();
+
+	void begin(Display* display);
+	uint8_t getWidth();
+	uint8_t getHeight();
+#ifndef FRAMEBUFFER_INDEXED
+	CRGB* getLeds();
+#endif
+	void setBrightness(uint8_t brightness);
+	void setPowerBudget(uint16_t milliamps);
+	uint8_t getLimitedBrightness();
+	uint16_t getEstimatedCurrent();
+	void set(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b);
+	void setUnchecked(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b);
+	// stores the pixel into a separate r, g, b buffer in the pixel order and
+	// color space of the frame buffer, which blend() then moves towards
+	void encode(uint8_t* buffer, int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b);
+	// moves the first pixels towards the encoded ones by fraction (Q8), 255 sets them
+	void blend(const uint8_t* to, uint16_t pixels, uint8_t fraction);
+	void fill(uint8_t r, uint8_t g, uint8_t b);
+	void fillRows(int8_t top, int8_t bottom, uint8_t r, uint8_t g, uint8_t b);
+	void encodeRows(uint8_t* buffer, int8_t top, int8_t bottom, uint8_t r, uint8_t g, uint8_t b);
+	void invalidate();
+	bool isDirty();
+	bool present();
+	void update();
+	uint32_t getFramesPresented();
+	uint32_t getFramesSkipped();
+	uint32_t getFramesDeferred();
+
+private:
+
+	struct Region {
+		int8_t left;
+		int8_t top;
+		int8_t right;
+		int8_t bottom;
+	};
+
+	uint8_t _width;
+	uint8_t _height;
+	uint8_t _brightness;
+	uint16_t _powerBudget;
+	uint8_t _limitedBrightness;
+	uint16_t _estimatedCurrent;
+	Region _dirty;
+	uint32_t _framesPresented;
+	uint32_t _framesSkipped;
+	uint32_t _framesDeferred;
+
+	Display* _display;
+
+#ifdef FRAMEBUFFER_INDEXED
+	uint8_t* _pixels; // two palette indices per byte, high nibble first
+	uint8_t _palette[FRAMEBUFFER_PALETTE_SIZE][3];
+	uint16_t _paletteRefs[FRAMEBUFFER_PALETTE_SIZE];
+
+	uint8_t _paletteIndex(uint8_t r, uint8_t g, uint8_t b);
+#else
+	CRGB* _leds;
+	uint32_t _channelSum; // sum of all color channels of all pixels
+#ifdef FRAMEBUFFER_ASYNC
+	CRGB* _front; // snapshot of _leds being streamed
+#endif
+#endif
+
+	void _put(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b);
+	uint32_t _getChannelSum();
+	void _limitPower();
+	uint16_t _ledIndex(int8_t x, int8_t y);
+	void _markDirty(int8_t x, int8_t y);
+	void _clean();
+};
+
+#endif
@@ -0,0 +1,92 @@
+#include "framebuffer_ops.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__SSE2__)
+
+// 16 byte lanes, the AVX2 path handles 32 bytes first and leaves the rest here
+static inline __m128i scale16(__m128i v, __m128i factor) {
+	__m128i zero = _mm_setzero_si128();
+	__m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(v, zero), factor), 8);
+	__m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(v, zero), factor), 8);
+
+	return _mm_packus_epi16(lo, hi);
+}
+
+static inline __m128i lerp16(__m128i a, __m128i b, __m128i factor) {
+	__m128i max = _mm_max_epu8(a, b);
+	__m128i delta = scale16(_mm_sub_epi8(max, _mm_min_epu8(a, b)), factor);
+	__m128i down = _mm_cmpeq_epi8(max, a);
+
+	return _mm_or_si128(
+			_mm_and_si128(down, _mm_sub_epi8(a, delta)),
+			_mm_andnot_si128(down, _mm_add_epi8(a, delta)));
+}
+
+#endif
+
+#if defined(__AVX2__)
+
+static inline __m256i scale32(__m256i v, __m256i factor) {
+	__m256i zero = _mm256_setzero_si256();
+	__m256i lo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(v, zero), factor), 8);
+	__m256i hi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(v, zero), factor), 8);
+
+	// unpack and pack both work within 128 bit lanes, so the order is kept
+	return _mm256_packus_epi16(lo, hi);
+}
+
+static inline __m256i lerp32(__m256i a, __m256i b, __m256i factor) {
+	__m256i max = _mm256_max_epu8(a, b);
+	__m256i delta = scale32(_mm256_sub_epi8(max, _mm256_min_epu8(a, b)), factor);
+	__m256i down = _mm256_cmpeq_epi8(max, a);
+
+	return _mm256_blendv_epi8(_mm256_add_epi8(a, delta), _mm256_sub_epi8(a, delta), down);
+}
+
+#endif
+
+void fbFill(uint8_t* dst, uint16_t pixels, uint8_t r, uint8_t g, uint8_t b) {
+	if (r == g && g == b) {
+		memset(dst, r, pixels * 3);
+		return;
+	}
+
+	for (uint8_t* end = dst + pixels * 3; dst < end; dst += 3) {
+		dst[0] = r;
+		dst[1] = g;
+		dst[2] = b;
+	}
+}
+
+void fbBlend(uint8_t* dst, const uint8_t* a, const uint8_t* b, uint16_t size, uint8_t fraction) {
+	uint16_t i = 0;
+
+#if defined(__AVX2__)
+	__m256i factor32 = _mm256_set1_epi16(fraction + 1);
+
+	for (; i + 32 <= size; i += 32) {
+		__m256i va = _mm256_loadu_si256((const __m256i*) (a + i));
+		__m256i vb = _mm256_loadu_si256((const __m256i*) (b + i));
+		_mm256_storeu_si256((__m256i*) (dst + i), lerp32(va, vb, factor32));
+	}
+#endif
+
+#if defined(__SSE2__)
+	__m128i factor16 = _mm_set1_epi16(fraction + 1);
+
+	for (; i + 16 <= size; i += 16) {
+		__m128i va = _mm_loadu_si128((const __m128i*) (a + i));
+		__m128i vb = _mm_loadu_si128((const __m128i*) (b + i));
+		_mm_storeu_si128((__m128i*) (dst + i), lerp16(va, vb, factor16));
+	}
+#endif
+
+	for (; i < size; ++i) {
+		dst[i] = lerpQ8(a[i], b[i], fraction);
+	}
+}
@@ -0,0 +1,15 @@
+#ifndef __FRAMEBUFFER_OPS_H
+#define __FRAMEBUFFER_OPS_H
+
+#include <inttypes.h>
+#include "graphics.h"
+
+// Bulk operations on packed r, g, b buffers (such as a CRGB array). Sizes
+// are given in bytes unless noted otherwise. The results match the scalar
+// lerpQ8 math exactly on every platform, see tools/host/fbcheck.cpp.
+
+void fbFill(uint8_t* dst, uint16_t pixels, uint8_t r, uint8_t g, uint8_t b);
+
+void fbBlend(uint8_t* dst, const uint8_t* a, const uint8_t* b, uint16_t size, uint8_t fraction);
+
+#endif
@@ -1,5 +1,37 @@
 #include "graphics.h"
 
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#else
+#ifndef PROGMEM
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*) (addr))
+#endif
+#endif
+
+// red channel of the hue wheel at full saturation and value, green and blue
+// are the same curve shifted by a third of the wheel
+static const uint8_t PROGMEM hueWheel[256] = {
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 247, 241, 235, 229,
+		223, 217, 211, 205, 199, 193, 187, 181, 175, 169, 163, 157, 151, 145, 139, 133,
+		128, 122, 116, 110, 104,  98,  92,  86,  80,  74,  68,  62,  56,  50,  44,  38,
+		 32,  26,  20,  14,   8,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   8,  14,  20,  26,
+		 32,  38,  44,  50,  56,  62,  68,  74,  80,  86,  92,  98, 104, 110, 116, 122,
+		128, 133, 139, 145, 151, 157, 163, 169, 175, 181, 187, 193, 199, 205, 211, 217,
+		223, 229, 235, 241, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+};
+
+#define hueChannel(h, s, v) scaleQ8(v, 255 - scaleQ8(255 - pgm_read_byte(hueWheel + (uint8_t) (h)), s))
+
 void transitionColor(
 		uint8_t r1, uint8_t g1, uint8_t b1,
 		uint8_t r2, uint8_t g2, uint8_t b2,
@@ -22,18 +54,80 @@ void pulsateColor(
 	storage[2] = b1 + (b2 - b1) * percents;
 }
 
+void pulsateColor8(
+		uint8_t r1, uint8_t g1, uint8_t b1,
+		uint8_t r2, uint8_t g2, uint8_t b2,
+		uint8_t fraction, uint8_t* storage) {
+
+	fraction = fraction & 0x80 ? (255 - fraction) << 1 | 1 : fraction << 1;
+
+	storage[0] = lerpQ8(r1, r2, fraction);
+	storage[1] = lerpQ8(g1, g2, fraction);
+	storage[2] = lerpQ8(b1, b2, fraction);
+}
+
+uint8_t fontHeight(fontDataReader fontDataReader, uint8_t* font) {
+	uint8_t header = fontDataReader(font);
+
+	return header == FONT_ATLAS_MAGIC ? fontDataReader(font + 1) : charHeight(header);
+}
+
+bool fontGlyph(fontDataReader fontDataReader, uint8_t* font, unsigned char c, Glyph* glyph) {
+	uint8_t header = fontDataReader(font);
+
+	if (header != FONT_ATLAS_MAGIC) {
+		if (c < 32 || c > FONT_LAST_CHAR) {
+			return false;
+		}
+
+		uint16_t charIndex = charIndex(c, bytesPerChar(header));
+
+		glyph->width = charWidth(fontDataReader(font + charIndex));
+		glyph->index = charIndex;
+		glyph->bitOffset = 4;
+
+		return true;
+	}
+
+	uint8_t first = fontDataReader(font + 2);
+	uint8_t count = fontDataReader(font + 3);
+	uint16_t table = FONT_ATLAS_HEADER_SIZE;
+	uint8_t idx;
+
+	if (fontDataReader(font + 4) & FONT_ATLAS_SPARSE) {
+		idx = fontDataReader(font + table + c);
+		table += FONT_ATLAS_MAP_SIZE;
+	} else {
+		idx = c >= first ? c - first : FONT_ATLAS_MISSING;
+	}
+
+	if (idx >= count) {
+		return false;
+	}
+
+	uint16_t offset = table + count + idx * 2;
+
+	glyph->width = fontDataReader(font + table + idx);
+	glyph->index = table + count * 3;
+	glyph->bitOffset = fontDataReader(font + offset) | fontDataReader(font + offset + 1) << 8;
+
+	return true;
+}
+
 void drawChar(canvas canvas, unsigned char c, int8_t x, int8_t y,
 		fontDataReader fontDataReader, uint8_t* font, uint8_t* color) {
 
-	uint8_t header = fontDataReader(font);
-	uint16_t charIndex = charIndex(c, bytesPerChar(header));
-	uint8_t charWidth = charWidth(fontDataReader(font + charIndex));
+	Glyph glyph;
 
-	for (uint8_t _y = 0, h = charHeight(header); _y < h; ++_y) {
-		for (uint8_t _x = 0; _x < charWidth; ++_x) {
-			uint8_t charPixelIndex = charPixelIndex(_x, _y, charWidth);
+	if (!fontGlyph(fontDataReader, font, c, &glyph)) {
+		return;
+	}
 
-			if (charPixel(fontDataReader(font + charPixelByteIndex(charIndex, charPixelIndex)), charPixelIndex)) {
+	for (uint8_t _y = 0, h = fontHeight(fontDataReader, font); _y < h; ++_y) {
+		for (uint8_t _x = 0; _x < glyph.width; ++_x) {
+			uint16_t bit = glyph.bitOffset + _y * glyph.width + _x;
+
+			if (charPixel(fontDataReader(font + glyph.index + bit / 8), bit)) {
 				canvas(x + _x, y + _y, color[0], color[1], color[2]);
 			}
 		}
@@ -58,6 +152,79 @@ void drawSprite(canvas canvas, const uint8_t palette[][3], spriteDataReader spri
 	} while(1);
 }
 
+uint8_t blitChar(canvas canvas, const ClipRect* clip, unsigned char c, int8_t x, int8_t y,
+		fontDataReader fontDataReader, uint8_t* font, uint8_t* color) {
+
+	Glyph glyph;
+
+	if (!fontGlyph(fontDataReader, font, c, &glyph)) {
+		return 0;
+	}
+
+	uint8_t height = fontHeight(fontDataReader, font);
+
+	// visible part of the glyph in glyph coordinates, empty if it is off-screen
+	int16_t left = clip->left > x ? clip->left - x : 0;
+	int16_t top = clip->top > y ? clip->top - y : 0;
+	int16_t right = clip->right < x + glyph.width ? clip->right - x : glyph.width;
+	int16_t bottom = clip->bottom < y + height ? clip->bottom - y : height;
+
+	for (int16_t _y = top; _y < bottom; ++_y) {
+		uint16_t bit = glyph.bitOffset + _y * glyph.width + left;
+
+		for (int16_t _x = left; _x < right; ++_x, ++bit) {
+			if (charPixel(fontDataReader(font + glyph.index + bit / 8), bit)) {
+				canvas(x + _x, y + _y, color[0], color[1], color[2]);
+			}
+		}
+	}
+
+	return glyph.width;
+}
+
+void blitSprite(canvas canvas, const ClipRect* clip, const uint8_t palette[][3], spriteDataReader spriteDataReader,
+		uint8_t* sprite, int8_t x, int8_t y, uint8_t width, uint8_t height) {
+
+	static const uint8_t black[3] = { 0, 0, 0 };
+
+	// visible part of the sprite in sprite coordinates
+	int16_t left = clip->left > x ? clip->left - x : 0;
+	int16_t top = clip->top > y ? clip->top - y : 0;
+	int16_t right = clip->right < x + width ? clip->right - x : width;
+	int16_t bottom = clip->bottom < y + height ? clip->bottom - y : height;
+
+	if (left >= right || top >= bottom) {
+		return;
+	}
+
+	bool inside = left == 0 && top == 0 && right == width && bottom == height;
+	uint8_t visibleWidth = right - left;
+	uint8_t visibleHeight = bottom - top;
+	uint8_t* addr = sprite;
+
+	do {
+		uint8_t colorIdx = spriteDataReader(addr++);
+		uint8_t pixelCount = spriteDataReader(addr++);
+
+		if (pixelCount == 0) {
+			break;
+		}
+
+		// delta sprites use a reserved index for pixels to turn off
+		const uint8_t* color = colorIdx == SPRITE_DELTA_CLEAR ? black : palette[colorIdx];
+
+		for (uint8_t p = 0; p < pixelCount; ++p) {
+			uint8_t coords = spriteDataReader(addr++);
+			uint8_t sx = spriteX(coords);
+			uint8_t sy = spriteY(coords);
+
+			if (inside || ((uint8_t) (sx - left) < visibleWidth && (uint8_t) (sy - top) < visibleHeight)) {
+				canvas(x + sx, y + sy, color[0], color[1], color[2]);
+			}
+		}
+	} while(1);
+}
+
 void hsv2rgb(double H, double S, double V, uint8_t* output) {
 	double r = 0, g = 0, b = 0;
 
@@ -122,6 +289,12 @@ void hsv2rgb(double H, double S, double V, uint8_t* output) {
 	output[2] = b * 255;
 }
 
+void hsv2rgb8(uint8_t h, uint8_t s, uint8_t v, uint8_t* output) {
+	output[0] = hueChannel(h, s, v);
+	output[1] = hueChannel(h - 85, s, v);
+	output[2] = hueChannel(h - 171, s, v);
+}
+
 void clearCanvas(canvas canvas, uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
 	for (uint8_t  _x = x; _x < width; ++_x) {
 		for (uint8_t _y = y; _y < height; ++_y) {
@@ -134,10 +307,12 @@ ScrollText::ScrollText(uint8_t x, uint8_t y, uint8_t width, fontDataReader fontD
 		_x(x), _y(y), _width(width), _fontDataReader(fontDataReader), _font(font),
 		_clearBackground(true), _text(NULL), _textLength(0), _position(0), _offset(0) {
 
-	uint8_t header = fontDataReader(font);
+	_charHeight = fontHeight(fontDataReader, font);
 
-	_charHeight = charHeight(header);
-	_bytesPerChar = bytesPerChar(header);
+	_clip.left = x;
+	_clip.top = y;
+	_clip.right = x + width;
+	_clip.bottom = y + _charHeight;
 }
 
 void ScrollText::setClearBackground(bool clearBackground) {
@@ -160,9 +335,7 @@ void ScrollText::draw(canvas canvas, uint8_t * color) {
 	uint16_t pos = _position;
 
 	for (int8_t x = _x + _offset, w = _x + _width; x < w;) {
-		drawChar(canvas, _text[pos], x, _y, _fontDataReader, _font, color);
-
-		x += charWidth(_fontDataReader(_font + charIndex(_text[pos], _bytesPerChar))) + 1;
+		x += blitChar(canvas, &_clip, _text[pos], x, _y, _fontDataReader, _font, color) + 1;
 
 		if (pos < _textLength - 1) {
 			pos++;
@@ -173,7 +346,8 @@ void ScrollText::draw(canvas canvas, uint8_t * color) {
 }
 
 bool ScrollText::scroll() {
-	int8_t charWidth = charWidth(_fontDataReader(_font + charIndex(_text[_position], _bytesPerChar)));
+	Glyph glyph;
+	int8_t charWidth = fontGlyph(_fontDataReader, _font, _text[_position], &glyph) ? glyph.width : 0;
 
 	if (_offset < -charWidth) {
 		_offset = -1;
@@ -197,11 +371,13 @@ bool ScrollText::scroll() {
 Animation::Animation(uint8_t frameCount): frameCount(frameCount) {
 	_durations = (unsigned long *) malloc(sizeof(unsigned long) * frameCount);
 	_sprites = (uint8_t**) malloc(sizeof(uint8_t*) * frameCount);
+	_deltas = (uint8_t**) malloc(sizeof(uint8_t*) * frameCount);
 }
 
-void Animation::setFrame(uint8_t idx, unsigned long duration, uint8_t* sprite) {
+void Animation::setFrame(uint8_t idx, unsigned long duration, uint8_t* sprite, uint8_t* delta) {
 	_durations[idx] = duration;
 	_sprites[idx] = sprite;
+	_deltas[idx] = delta;
 }
 
 unsigned long Animation::getDuration(uint8_t idx) {
@@ -211,3 +387,7 @@ unsigned long Animation::getDuration(uint8_t idx) {
 uint8_t* Animation::getSprite(uint8_t idx) {
 	return _sprites[idx];
 }
+
+uint8_t* Animation::getDelta(uint8_t idx) {
+	return _deltas[idx];
+}
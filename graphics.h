@@ -14,13 +14,55 @@
 #define charPixelByteIndex(charIndex, charPixelIndex) (charIndex + charPixelIndex / 8)
 #define charPixel(charByte, charPixelIndex) (charByte >> (7 - charPixelIndex % 8) & 0b1)
 
+// Glyph atlas font layout, recognized by a zero first byte (the header of a
+// fixed-width font never is zero):
+//   magic | height | first code point | glyph count | flags
+//   [256 byte code point map if FONT_ATLAS_SPARSE]
+//   glyph widths (1 byte each)
+//   glyph bit offsets into the bitmap (2 bytes each, little endian)
+//   bitmap, rows of every glyph packed back to back, MSB first
+#define FONT_ATLAS_MAGIC 0
+#define FONT_ATLAS_SPARSE 0b1
+#define FONT_ATLAS_HEADER_SIZE 5
+#define FONT_ATLAS_MAP_SIZE 256
+#define FONT_ATLAS_MISSING 0xff
+
+// last character of the fixed-width font format
+#define FONT_LAST_CHAR 126
+
 #define spriteX(i) (i >> 4)
 #define spriteY(i) (i & 0b1111)
 
+// Q8 fixed-point helpers, fractions are expressed in 1/256 units
+#define scaleQ8(i, fraction) ((uint8_t) (((uint16_t) (i) * ((uint16_t) (fraction) + 1)) >> 8))
+#define lerpQ8(a, b, fraction) ((a) > (b) ? (a) - scaleQ8((a) - (b), fraction) : (a) + scaleQ8((b) - (a), fraction))
+
+// color index used by delta sprites for pixels which have to be turned off
+#define SPRITE_DELTA_CLEAR 0xff
+
+// clipping rectangle, right and bottom edges are exclusive
+struct ClipRect {
+	int8_t left;
+	int8_t top;
+	int8_t right;
+	int8_t bottom;
+};
+
 typedef void (*canvas) (int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b);
 
+// sets the whole rows from top up to bottom (exclusive) to one color
+typedef void (*rowsCanvas) (int8_t top, int8_t bottom, uint8_t r, uint8_t g, uint8_t b);
+
 typedef uint8_t (*fontDataReader) (uint8_t* addr);
 
+// location of a glyph bitmap: pixel (x, y) is bit bitOffset + y * width + x
+// counted from the byte at index
+struct Glyph {
+	uint8_t width;
+	uint16_t index;
+	uint16_t bitOffset;
+};
+
 typedef uint8_t (*spriteDataReader) (uint8_t* addr);
 
 void transitionColor(
@@ -33,13 +75,30 @@ void pulsateColor(
 		uint8_t r2, uint8_t g2, uint8_t b2,
 		float percents, uint8_t* storage);
 
+void pulsateColor8(
+		uint8_t r1, uint8_t g1, uint8_t b1,
+		uint8_t r2, uint8_t g2, uint8_t b2,
+		uint8_t fraction, uint8_t* storage);
+
+uint8_t fontHeight(fontDataReader fontDataReader, uint8_t* font);
+
+bool fontGlyph(fontDataReader fontDataReader, uint8_t* font, unsigned char c, Glyph* glyph);
+
 void drawChar(canvas canvas, unsigned char c, int8_t x, int8_t y,
 		fontDataReader fontDataReader, const uint8_t* font, uint8_t* color);
 
 void drawSprite(canvas canvas, const uint8_t palette[][3], spriteDataReader spriteDataReader, uint8_t* sprite, int8_t x, int8_t y);
 
+uint8_t blitChar(canvas canvas, const ClipRect* clip, unsigned char c, int8_t x, int8_t y,
+		fontDataReader fontDataReader, uint8_t* font, uint8_t* color);
+
+void blitSprite(canvas canvas, const ClipRect* clip, const uint8_t palette[][3], spriteDataReader spriteDataReader,
+		uint8_t* sprite, int8_t x, int8_t y, uint8_t width, uint8_t height);
+
 void hsv2rgb(double H, double S, double V, uint8_t* output);
 
+void hsv2rgb8(uint8_t h, uint8_t s, uint8_t v, uint8_t* output);
+
 void clearCanvas(canvas canvas, uint8_t x, uint8_t y, uint8_t width, uint8_t height);
 
 class ScrollText {
@@ -61,7 +120,7 @@ private:
 	fontDataReader _fontDataReader;
 	uint8_t* _font;
 	uint8_t _charHeight;
-	uint8_t _bytesPerChar;
+	ClipRect _clip;
 	bool _clearBackground;
 	const char* _text;
 	uint16_t _textLength;
@@ -77,14 +136,16 @@ public:
 
 	Animation(uint8_t frameCount);
 
-	void setFrame(uint8_t idx, unsigned long duration, uint8_t* sprite);
+	void setFrame(uint8_t idx, unsigned long duration, uint8_t* sprite, uint8_t* delta);
 	unsigned long getDuration(uint8_t idx);
 	uint8_t* getSprite(uint8_t idx);
+	uint8_t* getDelta(uint8_t idx);
 
 private:
 
 	unsigned long* _durations;
 	uint8_t** _sprites;
+	uint8_t** _deltas; // pixels changed by the transition from the previous frame
 };
 
 #endif
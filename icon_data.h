@@ -0,0 +1,23 @@
+#ifndef __ICON_DATA_H
+#define __ICON_DATA_H
+
+#include "sprite_data.h"
+
+// header: width | height, then 2 bits per pixel row by row, padded to a
+// full byte per row: 0 - transparent, 1 - black, 2 - half tint, 3 - full tint
+
+const uint8_t SPRITE_STORAGE pauseIcon[] = {
+
+		8, 8,
+
+		0b01010101, 0b01010101,
+		0b01111101, 0b01111101,
+		0b01111101, 0b01111101,
+		0b01111101, 0b01111101,
+		0b01111101, 0b01111101,
+		0b01111101, 0b01111101,
+		0b01111101, 0b01111101,
+		0b01010101, 0b01010101
+};
+
+#endif
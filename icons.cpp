@@ -0,0 +1,60 @@
+#include "icons.h"
+
+Icon::Icon(spriteDataReader spriteDataReader, const uint8_t* data):
+		_spriteDataReader(spriteDataReader), _data(data), _mask(NULL) {
+
+	_width = spriteDataReader((uint8_t*) data);
+	_height = spriteDataReader((uint8_t*) data + 1);
+}
+
+Icon::~Icon() {
+	free(_mask);
+}
+
+uint8_t Icon::getWidth() {
+	return _width;
+}
+
+uint8_t Icon::getHeight() {
+	return _height;
+}
+
+void Icon::draw(canvas canvas, int8_t x, int8_t y, const uint8_t* tint) {
+	if (_mask == NULL) {
+		_rasterize();
+	}
+
+	// colors of the pixel classes for this frame
+	uint8_t colors[4][3];
+
+	for (uint8_t c = 0; c < 3; ++c) {
+		colors[ICON_BLACK][c] = 0;
+		colors[ICON_HALF_TINT][c] = tint[c] >> 1;
+		colors[ICON_FULL_TINT][c] = tint[c];
+	}
+
+	const uint8_t* mask = _mask;
+
+	for (uint8_t _y = 0; _y < _height; ++_y) {
+		for (uint8_t _x = 0; _x < _width; ++_x, ++mask) {
+			if (*mask != ICON_TRANSPARENT) {
+				const uint8_t* color = colors[*mask];
+				canvas(x + _x, y + _y, color[0], color[1], color[2]);
+			}
+		}
+	}
+}
+
+void Icon::_rasterize() {
+	_mask = (uint8_t*) malloc(_width * _height);
+
+	uint8_t* addr = (uint8_t*) _data + 2;
+	uint8_t* mask = _mask;
+	uint8_t bytesPerRow = (_width + 3) / 4;
+
+	for (uint8_t _y = 0; _y < _height; ++_y, addr += bytesPerRow) {
+		for (uint8_t _x = 0; _x < _width; ++_x) {
+			*mask++ = _spriteDataReader(addr + _x / 4) >> (6 - (_x % 4) * 2) & 0b11;
+		}
+	}
+}
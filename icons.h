@@ -0,0 +1,36 @@
+#ifndef __ICONS_H
+#define __ICONS_H
+
+#include <stdlib.h>
+#include <inttypes.h>
+#include "graphics.h"
+
+#define ICON_TRANSPARENT 0
+#define ICON_BLACK       1
+#define ICON_HALF_TINT   2
+#define ICON_FULL_TINT   3
+
+class Icon {
+
+public:
+
+	Icon(spriteDataReader spriteDataReader, const uint8_t* data);
+
+	~Icon();
+
+	uint8_t getWidth();
+	uint8_t getHeight();
+	void draw(canvas canvas, int8_t x, int8_t y, const uint8_t* tint);
+
+private:
+
+	spriteDataReader _spriteDataReader;
+	const uint8_t* _data;
+	uint8_t _width;
+	uint8_t _height;
+	uint8_t* _mask; // one pixel class per byte, rasterized on first use
+
+	void _rasterize();
+};
+
+#endif
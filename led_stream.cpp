@@ -0,0 +1,60 @@
+#include "led_stream.h"
+
+#if defined(__AVR_ATmega1284__) || defined(__AVR_ATmega1284P__)
+
+LedStream::LedStream() {}
+
+void LedStream::begin(uint8_t width, uint8_t height) {
+	Display::begin(width, height);
+
+	// the baud rate register has to be zero while the transmitter gets enabled
+	UBRR1 = 0;
+
+	// XCK1 has to be an output for master SPI mode
+	DDRD |= _BV(PD4);
+
+	UCSR1C = _BV(UMSEL11) | _BV(UMSEL10); // master SPI, MSB first, mode 0
+	UCSR1B = _BV(TXEN1);
+
+	// F_CPU / 2, the fastest clock the USART supports
+	UBRR1 = 0;
+}
+
+void LedStream::startFrame() {
+	for (uint8_t i = 0; i < 4; ++i) {
+		_transfer(0x00);
+	}
+}
+
+void LedStream::writePixel(uint8_t r, uint8_t g, uint8_t b) {
+	// full global brightness, dimming is done on the color values
+	_transfer(0xff);
+	_transfer(b);
+	_transfer(g);
+	_transfer(r);
+}
+
+void LedStream::endFrame() {
+	uint16_t ledCount = getLedCount();
+
+	// SK9822 needs an extra frame to latch, then one clock edge per two LEDs
+	for (uint8_t i = 0; i < 4; ++i) {
+		_transfer(0x00);
+	}
+
+	for (uint16_t i = 0, n = (ledCount + 15) / 16; i < n; ++i) {
+		_transfer(0x00);
+	}
+
+	// wait until the last byte has left the shift register
+	while (!(UCSR1A & _BV(TXC1)));
+}
+
+void LedStream::_transfer(uint8_t data) {
+	while (!(UCSR1A & _BV(UDRE1)));
+
+	UCSR1A = _BV(TXC1);
+	UDR1 = data;
+}
+
+#endif // __AVR_ATmega1284__ || __AVR_ATmega1284P__
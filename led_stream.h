@@ -0,0 +1,30 @@
+#ifndef __LED_STREAM_H
+#define __LED_STREAM_H
+
+#include <Arduino.h>
+#include <inttypes.h>
+#include "display.h"
+
+// minimal SK9822 output on USART1 in master SPI mode (TXD1 = data, XCK1 = clock)
+//
+// Bytes are polled out at F_CPU / 2, 16 CPU cycles each. A frame of 200 LEDs
+// is 821 bytes (4 header, 4 per LED, 17 trailer), about 13k cycles or 0.7 ms,
+// the same as FastLED. Written with Display::update() it is spread over
+// several calls instead of one.
+class LedStream: public Display {
+
+public:
+
+	LedStream();
+
+	void begin(uint8_t width, uint8_t height);
+	void startFrame();
+	void writePixel(uint8_t r, uint8_t g, uint8_t b);
+	void endFrame();
+
+private:
+
+	void _transfer(uint8_t data);
+};
+
+#endif
@@ -1,8 +1,17 @@
 #include "main.h"
 
 // display
-CRGB leds[NUM_LEDS];
-Timer displayTimer(LED_FPS);
+FrameBuffer frameBuffer(canvasWidth(), canvasHeight());
+#ifdef FRAMEBUFFER_LED_STREAM
+LedStream ledDisplay;
+#else
+FastLEDDisplay ledDisplay;
+#endif
+FrameScheduler frameScheduler(LED_FPS);
+QualityGovernor qualityGovernor(LOOP_BUDGET_US, &qualityChanged);
+Compositor compositor(canvasWidth(), canvasHeight());
+Transition transition(canvasWidth(), canvasHeight());
+Particles particles(canvasWidth(), canvasHeight());
 
 // vibra-motor
 Adafruit_DRV2605 vibra;
@@ -31,6 +40,15 @@ Catris catris(
 // game engine
 Tetris* tetris;
 
+// overlay icons
+Icon pauseSign(
+#ifdef SPRITES_IN_PROGMEM
+	&progMemRead
+#else
+	&directMemRead
+#endif
+, pauseIcon);
+
 // low battery signal
 Bounce lowBattery = Bounce();
 
@@ -52,6 +70,7 @@ Timer rainbowTimer(5000);
 Timer surpriseConfigTimer(0);
 Timer highScoreClearTimer(0);
 Timer batteryCheckTimer(MILLIS_BATTERY_CHECK_INTERVAL);
+Timer frameStatsTimer(MILLIS_FRAME_STATS_INTERVAL);
 
 // persistent state variables
 byte music = 0;
@@ -61,6 +80,8 @@ uint32_t highScore = 0;
 
 // volatile state variables
 uint8_t state = STATE_CATRIS_LOOP;
+bool catrisPending = false;
+bool catrisPendingLoop = false;
 bool clearCanvasOnNextLoop = true;
 bool surpriseMentioned = false;
 bool lowBatteryDetected = false;
@@ -124,8 +145,12 @@ void setup() {
 	playMusic();
 
 	// initialize display
-    FastLED.addLeds<LED_TYPE, LED_SDI, LED_SCK, COLOR_ORDER, DATA_RATE_MHZ(20)>(leds, NUM_LEDS).setCorrection(UncorrectedColor);
-    FastLED.setBrightness(BRIGHTNESS);
+#ifndef FRAMEBUFFER_LED_STREAM
+    ledDisplay.setController(&FastLED.addLeds<LED_TYPE, LED_SDI, LED_SCK, COLOR_ORDER, DATA_RATE_MHZ(20)>(frameBuffer.getLeds(), NUM_LEDS).setCorrection(UncorrectedColor));
+#endif
+    frameBuffer.begin(&ledDisplay);
+    frameBuffer.setBrightness(BRIGHTNESS);
+    frameBuffer.setPowerBudget(LED_POWER_BUDGET_MA);
 
     // initialize vibra-motor
     vibra.begin();
@@ -222,9 +247,10 @@ void loop() {
 
 	catris.update();
 
-    if (displayTimer.fire()) {
-    	catris.draw(&setCanvas);
-    	FastLED.show();
+    if (frameScheduler.due()) {
+    	catris.draw(&setCanvasUnchecked, &fillCanvasRows);
+    	frameBuffer.present();
+    	frameScheduler.frameDone();
     }
 
 	tray.update();
@@ -233,6 +259,8 @@ void loop() {
 #else
 
 void loop() {
+	qualityGovernor.update();
+
 	lowBattery.update();
 
 	pauseButton.update();
@@ -251,9 +279,11 @@ void loop() {
 		clrscr();
 	}
 
-	if (music) {
-		audio.update();
-	}
+	// also mixes the sound effects while the music is off
+	audio.update();
+
+	// sends the next few pixels of an async frame
+	frameBuffer.update();
 
 	if (soundButton.rose()) {
 		sound = !sound;
@@ -344,6 +374,8 @@ void loop() {
 		}
 	}
 
+	frameBuffer.setPowerBudget(lowBatteryDetected ? LED_POWER_BUDGET_LOW_BATTERY_MA : LED_POWER_BUDGET_MA);
+
 	if (isCatris()) {
 		if (rightButton.rose()) {
 			buttonRepeat(true);
@@ -364,9 +396,23 @@ void loop() {
 			showTetris();
 		}
 
-	    if (displayTimer.fire()) {
-	    	catris.draw(&setCanvas);
-	    	FastLED.show();
+	    // showTetris() may have switched screens already
+	    if (isCatris() && frameScheduler.due()) {
+	    	catris.draw(screenCanvas(), screenRowsCanvas());
+	    	presentScreen();
+	    }
+	} else if (isTetris() && catrisPending) {
+		// the game holds until the row clear effect has played out
+	    if (frameScheduler.due()) {
+	    	particles.update();
+
+	    	if (particles.isActive()) {
+	    		drawTetris();
+	    	} else {
+	    		showCatris(catrisPendingLoop);
+	    	}
+
+	    	presentScreen();
 	    }
 	} else if (isTetris()) {
 		if (pauseButton.rose()) {
@@ -452,8 +498,11 @@ void loop() {
 
 		tetris->update();
 
-	    if (displayTimer.fire()) {
-	    	if (tetris->isGameOver()) {
+	    if (frameScheduler.due()) {
+	    	particles.update();
+
+	    	// the game over screen waits for the particle effect to finish
+	    	if (tetris->isGameOver() && !particles.isActive()) {
 	    		playVibra(gameOverVibra);
 
 	    		uint32_t scores = tetris->getScores();
@@ -493,17 +542,17 @@ void loop() {
 
 				showCatris(true);
 	    	} else {
-		    	tetris->draw(&setCanvas);
-
-		    	if (tetris->isPaused()) {
-					showPauseSign();
-				}
+	    		drawTetris();
 	    	}
 
-	    	FastLED.show();
+	    	presentScreen();
 	    }
 	}
 
+	if (DEBUG) {
+		printFrameStats();
+	}
+
 	tray.update();
 }
 
@@ -515,16 +564,16 @@ void playMusic() {
 		audio.stop();
 		break;
 	case 1:
-		audio.start(pmfTetris);
+		audio.start(pmfTetris, pmfTetrisSeek);
 		break;
 	case 2:
-		audio.start(pmfLoveYa);
+		audio.start(pmfLoveYa, pmfLoveYaSeek);
 		break;
 	case 3:
-		audio.start(pmfLoveInMyDreams);
+		audio.start(pmfLoveInMyDreams, pmfLoveInMyDreamsSeek);
 		break;
 	case 4:
-		audio.start(pmfChippy);
+		audio.start(pmfChippy, pmfChippySeek);
 		break;
 	}
 }
@@ -532,21 +581,21 @@ void playMusic() {
 void playBeepUpSound() {
 	if (sound) {
 		const uint16_t size = sizeof(pcmBeepUp) / sizeof(pcmBeepUp[0]);
-		audio.mixin(pcmBeepUp, size);
+		audio.play_sfx(pcmBeepUp, size, SFX_PRIORITY_BEEP);
 	}
 }
 
 void playBeepDownSound() {
 	if (sound) {
 		const uint16_t size = sizeof(pcmBeepDown) / sizeof(pcmBeepDown[0]);
-		audio.mixin(pcmBeepDown, size);
+		audio.play_sfx(pcmBeepDown, size, SFX_PRIORITY_BEEP);
 	}
 }
 
 void playSuccessSound() {
 	if (sound) {
 		const uint16_t size = sizeof(pcmSuccess) / sizeof(pcmSuccess[0]);
-		audio.mixin(pcmSuccess, size);
+		audio.play_sfx(pcmSuccess, size, SFX_PRIORITY_SUCCESS);
 	}
 }
 
@@ -563,11 +612,31 @@ void playVibra(const uint8_t* pattern) {
 }
 
 void setCanvas(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b) {
-	if (x < 0 || x >= canvasWidth() || y < 0 || y >= canvasHeight()) {
-		return;
-	}
+	frameBuffer.set(x, y, r, g, b);
+}
 
-	leds[y * canvasWidth() + (y % 2 == 0 ? x : canvasWidth() - x - 1)].setRGB(r, g, b);
+void setCanvasUnchecked(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b) {
+	frameBuffer.setUnchecked(x, y, r, g, b);
+}
+
+void setLayerCanvas(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b) {
+	compositor.set(x, y, r, g, b);
+}
+
+void setTransitionCanvas(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b) {
+	frameBuffer.encode(transition.getBuffer(), x, y, r, g, b);
+}
+
+void fillCanvasRows(int8_t top, int8_t bottom, uint8_t r, uint8_t g, uint8_t b) {
+	frameBuffer.fillRows(top, bottom, r, g, b);
+}
+
+void fillTransitionRows(int8_t top, int8_t bottom, uint8_t r, uint8_t g, uint8_t b) {
+	frameBuffer.encodeRows(transition.getBuffer(), top, bottom, r, g, b);
+}
+
+void blendScreen(const uint8_t* to, uint16_t pixels, uint8_t fraction) {
+	frameBuffer.blend(to, pixels, fraction);
 }
 
 void tetrisEvent(TetrisEvent event, uint8_t data) {
@@ -584,11 +653,14 @@ void tetrisEvent(TetrisEvent event, uint8_t data) {
 				"    There's no stopping. Let's see level %" PRIu8 ". %" PRIu32 " points earned so far.",
 				"    Easy peasy! Here comes level %" PRIu8 "! Mighty %" PRIu32 " points for you."), data, tetris->getScores());
 
-		showCatris(false);
+		emitClearedRows();
+		queueCatris(false);
 		break;
 	case TetrisEvent::RowsCompleted:
 		playSuccessSound();
 
+		emitClearedRows();
+
 		if (surprise) {
 			uint32_t scores = tetris->getScores();
 
@@ -601,7 +673,7 @@ void tetrisEvent(TetrisEvent event, uint8_t data) {
 
 				catris.setAnimation(Catris::Anim::InLove);
 				catris.setText("    OMG 2sofix! Maci has a question for you: Will you marry him?");
-				showCatris(true);
+				queueCatris(true);
 
 				return;
 			}
@@ -613,7 +685,7 @@ void tetrisEvent(TetrisEvent event, uint8_t data) {
 
 				catris.setAnimation(Catris::Anim::Shocked);
 				catris.setFormattedText("    %" PRIu32 " points already! There is a surprise waiting for you at %d points. Press >> to go for it!", scores, SCORES_SURPRISE_REVEAL);
-				showCatris(true);
+				queueCatris(true);
 
 				return;
 			}
@@ -632,7 +704,7 @@ void tetrisEvent(TetrisEvent event, uint8_t data) {
 						"    That's how professionals begin!"
 						"    Tetrominoes are all afraid of you now!"));
 
-				showCatris(false);
+				queueCatris(false);
 			}
 			break;
 		case 2:
@@ -649,7 +721,7 @@ void tetrisEvent(TetrisEvent event, uint8_t data) {
 					"    Playing fancy? 3 by 1.",
 					"    I'm starting to take you seriously. 3 by 1."));
 
-			showCatris(false);
+			queueCatris(false);
 			break;
 		case 4:
 			playVibra(tetrisVibra);
@@ -662,12 +734,23 @@ void tetrisEvent(TetrisEvent event, uint8_t data) {
 					"    TETRIS! Tetrominoes, obey 2sofix!",
 					"    TETRIS! It's just crazy!"));
 
-			showCatris(false);
+			queueCatris(false);
 			break;
 		default:
 			;
 		}
 		break;
+	case TetrisEvent::GameOver:
+		// the game over screen replaces a message of the last clear
+		catrisPending = false;
+
+		for (uint8_t y = 0; y < canvasHeight(); y += GAME_OVER_PARTICLE_ROW_STEP) {
+			uint8_t color[3];
+			hsv2rgb8(y * 256 / canvasHeight(), 255, 255, color);
+
+			particles.emitRow(y, color);
+		}
+		break;
 	default:
 		;
 	}
@@ -682,31 +765,53 @@ bool buttonRepeat(bool reset) {
 	return buttonTimer.fire();
 }
 
-void showPauseSign() {
-	uint8_t hue = rainbowTimer.progress(true) * 255;
+void drawTetris() {
+	compositor.begin(Compositor::Pile);
+	tetris->drawPile(&setLayerCanvas);
+	compositor.end();
 
-	for (uint8_t i = 61; i < 69; ++i) {
-		leds[i] = CRGB::Black;
-	}
+	compositor.begin(Compositor::Ghost);
+	tetris->drawGhost(&setLayerCanvas);
+	compositor.end();
+
+	compositor.begin(Compositor::Piece);
+	tetris->drawPiece(&setLayerCanvas);
+	compositor.end();
+
+	compositor.begin(Compositor::Particles);
+	particles.draw(&setLayerCanvas);
+	compositor.end();
 
-	for (uint8_t i = 70; i < 130; i+=10) {
-		leds[i + 1] = CRGB::Black;
-		leds[i + 2].setHSV(hue, 255, 255);
-		leds[i + 3].setHSV(hue, 255, 255);
-		leds[i + 4] = CRGB::Black;
-		leds[i + 5] = CRGB::Black;
-		leds[i + 6].setHSV(hue, 255, 255);
-		leds[i + 7].setHSV(hue, 255, 255);
-		leds[i + 8] = CRGB::Black;
+	compositor.begin(Compositor::Overlay);
+
+	if (tetris->isPaused()) {
+		showPauseSign();
 	}
 
-	for (uint8_t i = 131; i < 139; ++i) {
-		leds[i] = CRGB::Black;
+	compositor.end();
+
+	compositor.compose(screenCanvas());
+}
+
+void showPauseSign() {
+	uint8_t color[3];
+	hsv2rgb8(rainbowTimer.progress8(), 255, 255, color);
+
+	pauseSign.draw(&setLayerCanvas, 1, 6, color);
+}
+
+void emitClearedRows() {
+	static const uint8_t white[3] = { 255, 255, 255 };
+
+	for (uint8_t i = 0; i < tetris->getClearedRowCount(); ++i) {
+		particles.emitRow(tetris->getClearedRow(i), white);
 	}
 }
 
 void resetTetris() {
 	tetris->reset();
+	particles.clear();
+	catrisPending = false;
 	surpriseMentioned = false;
 }
 
@@ -719,7 +824,125 @@ void showTetris() {
 		resetTetris();
 	}
 
+	startTransition(Transition::Wipe);
+
 	state = STATE_TETRIS;
+
+	// the incoming screen has to be drawn in full, before the first frame
+	// of the transition renders it
+	compositor.invalidate();
+	drawTetris();
+}
+
+void startTransition(Transition::Effect effect) {
+	// the frame buffer still holds the outgoing screen
+	transition.begin(effect, TRANSITION_FRAMES);
+}
+
+canvas screenCanvas() {
+	// screens draw into the incoming buffer while a transition runs
+	return transition.isRunning() ? &setTransitionCanvas : &setCanvasUnchecked;
+}
+
+rowsCanvas screenRowsCanvas() {
+	return transition.isRunning() ? &fillTransitionRows : &fillCanvasRows;
+}
+
+void presentScreen() {
+	transition.render(&blendScreen);
+	frameBuffer.present();
+	frameScheduler.frameDone();
+}
+
+void formatHistogram(char* text, const char* name, const uint16_t* histogram, uint8_t buckets) {
+	uint8_t length = snprintf_P(text, FRAME_STATS_LINE_SIZE, PSTR("%s"), name);
+
+	for (uint8_t i = 0; i < buckets && length < FRAME_STATS_LINE_SIZE; ++i) {
+		length += snprintf_P(text + length, FRAME_STATS_LINE_SIZE - length, PSTR(" %u"), histogram[i]);
+	}
+}
+
+void qualityChanged(QualityGovernor::Level level, uint32_t maxIterationTime) {
+	frameScheduler.setFps(level >= QualityGovernor::ReducedFps ? LED_FPS_REDUCED : LED_FPS);
+	tetris->setGhostPulseEnabled(level < QualityGovernor::NoGhostPulse);
+	audio.set_max_mix_channels(level >= QualityGovernor::ReducedChannels ? AUDIO_REDUCED_CHANNELS : 0);
+
+	if (DEBUG) {
+		Serial.print(F("quality level: "));
+		Serial.print(level);
+		Serial.print(F(", max iteration: "));
+		Serial.print(maxIterationTime);
+		Serial.print(F(" us, budget: "));
+		Serial.print(qualityGovernor.getBudget());
+		Serial.println(F(" us"));
+	}
+}
+
+void printFrameStats() {
+	// copies of the stats being printed, new ones are gathered meanwhile
+	static FrameScheduler frames(LED_FPS);
+	static pmf_audio_stats audioStats;
+	static uint32_t presented, skipped, deferred;
+	static uint8_t line = FRAME_STATS_LINES;
+
+	if (line == FRAME_STATS_LINES) {
+		if (!frameStatsTimer.fire()) {
+			return;
+		}
+
+		frames = frameScheduler;
+		audioStats = audio.stats();
+		presented = frameBuffer.getFramesPresented();
+		skipped = frameBuffer.getFramesSkipped();
+		deferred = frameBuffer.getFramesDeferred();
+
+		frameScheduler.resetStats();
+		audio.reset_stats();
+
+		line = 0;
+	}
+
+	// a line at a time once it fits into the transmit buffer with its line
+	// break, so that printing never waits for the serial port and distorts
+	// the stats
+	if (Serial.availableForWrite() < FRAME_STATS_LINE_SIZE + 1) {
+		return;
+	}
+
+	char text[FRAME_STATS_LINE_SIZE];
+
+	switch (line) {
+	case 0:
+		snprintf_P(text, sizeof(text), PSTR("fps: %u, frames: %lu, max frame time: %lu us"),
+				frames.getFps(), frames.getFrames(), frames.getMaxFrameTime());
+		break;
+	case 1:
+		snprintf_P(text, sizeof(text), PSTR("presented: %lu, skipped: %lu"), presented, skipped);
+		break;
+	case 2:
+		snprintf_P(text, sizeof(text), PSTR("deferred: %lu"), deferred);
+		break;
+	case 3:
+		// bucket limits double from FRAME_HISTOGRAM_BASE_US on
+		formatHistogram(text, "frame time:", frames.getFrameTimeHistogram(), FRAME_HISTOGRAM_BUCKETS);
+		break;
+	case 4:
+		formatHistogram(text, "jitter:    ", frames.getJitterHistogram(), FRAME_HISTOGRAM_BUCKETS);
+		break;
+	case 5:
+		formatHistogram(text, "missed:    ", frames.getMissedHistogram(), FRAME_MISSED_BUCKETS);
+		break;
+	case 6:
+		snprintf_P(text, sizeof(text), PSTR("audio underruns: %u, late refills: %u"),
+				audioStats.num_underruns, audioStats.num_late_refills);
+		break;
+	default:
+		snprintf_P(text, sizeof(text), PSTR("buffered: %u to %u samples, max isr: %u cycles"),
+				audioStats.min_buffered_samples, audioStats.max_buffered_samples, audioStats.max_isr_cycles);
+	}
+
+	Serial.println(text);
+	line++;
 }
 
 bool isCatris() {
@@ -727,10 +950,26 @@ bool isCatris() {
 }
 
 void showCatris(bool loop) {
-	clearCanvasOnNextLoop = true;
+	startTransition(Transition::Blend);
+
+	// effects of the game screen do not carry over
+	particles.clear();
+
+	// drawn right away, the first frame of the transition may render it in
+	// the same loop iteration
+	catris.invalidate();
+	catris.draw(screenCanvas(), screenRowsCanvas());
+
+	catrisPending = false;
 	state = loop ? STATE_CATRIS_LOOP : STATE_CATRIS_ONCE;
 }
 
+void queueCatris(bool loop) {
+	// switches once the particles of the clear are gone, see loop()
+	catrisPending = true;
+	catrisPendingLoop = loop;
+}
+
 uint8_t progMemRead(uint8_t* addr) {
 	return pgm_read_byte(addr);
 }
@@ -758,3 +997,11 @@ const char* randomText(uint8_t count, ...) {
 unsigned long Timer::_millis() {
 	return millis();
 }
+
+unsigned long FrameScheduler::_micros() {
+	return micros();
+}
+
+unsigned long QualityGovernor::_micros() {
+	return micros();
+}
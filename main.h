@@ -8,6 +8,11 @@
 
 // debug mode
 #define DEBUG false
+#define MILLIS_FRAME_STATS_INTERVAL 5000
+// the stats go out a line per loop iteration, each has to fit into the
+// 64 byte serial transmit buffer including the line break
+#define FRAME_STATS_LINES 8
+#define FRAME_STATS_LINE_SIZE 62
 
 // display
 #define SPI_UART1_DATA  11
@@ -17,15 +22,29 @@
 #define LED_TYPE        SK9822
 #define COLOR_ORDER     BGR
 #define LED_FPS         60
+#define LED_FPS_REDUCED 30
 #define BRIGHTNESS		30
+#define LED_POWER_BUDGET_MA             1000
+#define LED_POWER_BUDGET_LOW_BATTERY_MA  400
 #include <FastLED.h>
+#include "framebuffer.h"
+#ifdef FRAMEBUFFER_LED_STREAM
+#include "led_stream.h"
+#else
+#include "fastled_display.h"
+#endif
+#include "frame_scheduler.h"
 
 // audio
+#define AUDIO_REDUCED_CHANNELS 4
+#define SFX_PRIORITY_BEEP    0
+#define SFX_PRIORITY_SUCCESS 1
 #include "pmf_player.h"
 #include "pmf_data.h"
 
 // audio data
 #include "audio_data.h"
+#include "pmf_seek_data.h"
 
 // vibration data
 #include "vibra_data.h"
@@ -45,12 +64,36 @@
 // catris
 #include "catris.h"
 
+// layer compositing
+#include "compositor.h"
+
+// screen transitions
+#include "transition.h"
+
+// particle effects
+#include "particles.h"
+
+#if LEDS_PER_ROW > COMPOSITOR_MAX_WIDTH
+#error COMPOSITOR_MAX_WIDTH has to cover a whole row
+#endif
+
+#if COMPOSITOR_PARTICLES_PIXELS < PARTICLE_POOL_SIZE
+#error COMPOSITOR_PARTICLES_PIXELS has to hold the whole particle pool
+#endif
+
+// overlay icons
+#include "icons.h"
+#include "icon_data.h"
+
 // game engine
 #include "tetris.h"
 
 // random seed
 #include "entropy.h"
 
+// quality degradation when the loop overruns
+#include "quality_governor.h"
+
 // pin configuration
 #define LBO 10
 #define LED_LB 18
@@ -108,6 +151,15 @@
 #define SCORES_SURPRISE_TEASER 1500
 #define SCORES_SURPRISE_REVEAL 3000
 
+// screen transitions
+#define TRANSITION_FRAMES 20
+
+// game over particle effect, a row of particles every few rows
+#define GAME_OVER_PARTICLE_ROW_STEP 5
+
+// longest loop iteration that leaves the audio buffer refill enough slack
+#define LOOP_BUDGET_US 6000
+
 // low battery detection
 #define LOW_BAT_DETECTION_LIMIT 30
 #define MILLIS_BATTERY_CHECK_INTERVAL 1000
@@ -127,7 +179,7 @@
 // macros
 #define canvasWidth() LEDS_PER_ROW
 #define canvasHeight() (NUM_LEDS / LEDS_PER_ROW)
-#define clrscr() clearCanvas(&setCanvas, 0, 0, canvasWidth(), canvasHeight())
+#define clrscr() frameBuffer.fill(0, 0, 0)
 
 // functions
 void playMusic();
@@ -137,13 +189,29 @@ void playSuccessSound();
 void playVibra(const uint8_t* pattern);
 void tetrisEvent(TetrisEvent event, uint8_t data);
 bool buttonRepeat(bool reset);
+void drawTetris();
+void emitClearedRows();
+void startTransition(Transition::Effect effect);
+canvas screenCanvas();
+rowsCanvas screenRowsCanvas();
+void presentScreen();
+void formatHistogram(char* text, const char* name, const uint16_t* histogram, uint8_t buckets);
+void printFrameStats();
+void qualityChanged(QualityGovernor::Level level, uint32_t maxIterationTime);
 void showPauseSign();
 void resetTetris();
 bool isTetris();
 void showTetris();
 bool isCatris();
 void showCatris(bool loop);
+void queueCatris(bool loop);
 void setCanvas(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b);
+void setCanvasUnchecked(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b);
+void setLayerCanvas(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b);
+void setTransitionCanvas(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b);
+void fillCanvasRows(int8_t top, int8_t bottom, uint8_t r, uint8_t g, uint8_t b);
+void fillTransitionRows(int8_t top, int8_t bottom, uint8_t r, uint8_t g, uint8_t b);
+void blendScreen(const uint8_t* to, uint16_t pixels, uint8_t fraction);
 uint8_t progMemRead(uint8_t* addr);
 uint8_t directMemRead(uint8_t* addr);
 const char* randomText(uint8_t count, ...);
@@ -0,0 +1,84 @@
+#include "particles.h"
+
+#define randomRange(min, max) ((min) + rand() % ((max) - (min) + 1))
+
+Particles::Particles(uint8_t width, uint8_t height):
+		_width(width), _height(height), _count(0) {}
+
+void Particles::emit(int8_t x, int8_t y, int16_t vx, int16_t vy, uint8_t life, const uint8_t* color) {
+	if (_count == PARTICLE_POOL_SIZE) {
+		return;
+	}
+
+	uint8_t i = _count++;
+
+	// start in the middle of the pixel
+	_x[i] = toFixed8(x) + 128;
+	_y[i] = toFixed8(y) + 128;
+	_vx[i] = vx;
+	_vy[i] = vy;
+	_life[i] = life;
+	_r[i] = color[0];
+	_g[i] = color[1];
+	_b[i] = color[2];
+}
+
+void Particles::emitRow(int8_t y, const uint8_t* color) {
+	for (uint8_t x = 0; x < _width; ++x) {
+		emit(x, y, randomRange(-64, 64), randomRange(-288, -96), randomRange(24, 48), color);
+	}
+}
+
+bool Particles::isActive() {
+	return _count > 0;
+}
+
+void Particles::clear() {
+	_count = 0;
+}
+
+void Particles::update() {
+	int16_t right = toFixed8(_width);
+	int16_t bottom = toFixed8(_height);
+
+	for (uint8_t i = 0; i < _count;) {
+		_vy[i] += PARTICLE_GRAVITY;
+		_x[i] += _vx[i];
+		_y[i] += _vy[i];
+
+		// particles are dropped when they expire or leave the screen sideways
+		// or at the bottom, the ones above the top may still fall back
+		if (--_life[i] == 0 || _x[i] < 0 || _x[i] >= right || _y[i] >= bottom) {
+			_remove(i);
+		} else {
+			++i;
+		}
+	}
+}
+
+void Particles::draw(canvas canvas) {
+	for (uint8_t i = 0; i < _count; ++i) {
+		if (_y[i] < 0) {
+			continue;
+		}
+
+		// fade out during the last 16 frames
+		uint8_t fade = _life[i] >= 16 ? 255 : _life[i] << 4;
+
+		canvas(fromFixed8(_x[i]), fromFixed8(_y[i]),
+				scaleQ8(_r[i], fade), scaleQ8(_g[i], fade), scaleQ8(_b[i], fade));
+	}
+}
+
+void Particles::_remove(uint8_t idx) {
+	uint8_t last = --_count;
+
+	_x[idx] = _x[last];
+	_y[idx] = _y[last];
+	_vx[idx] = _vx[last];
+	_vy[idx] = _vy[last];
+	_life[idx] = _life[last];
+	_r[idx] = _r[last];
+	_g[idx] = _g[last];
+	_b[idx] = _b[last];
+}
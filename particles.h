@@ -0,0 +1,51 @@
+#ifndef __PARTICLES_H
+#define __PARTICLES_H
+
+#include <stdlib.h>
+#include <inttypes.h>
+#include "graphics.h"
+
+// Size of the pool, which is also the upper limit of particles updated and
+// drawn per frame. Emitting into a full pool is ignored.
+#define PARTICLE_POOL_SIZE 48
+
+// 8.8 fixed-point helpers
+#define toFixed8(i) ((int16_t) (i) << 8)
+#define fromFixed8(i) ((int8_t) ((i) >> 8))
+
+// velocity change per frame pulling the particles down
+#define PARTICLE_GRAVITY 14
+
+class Particles {
+
+public:
+
+	Particles(uint8_t width, uint8_t height);
+
+	void emit(int8_t x, int8_t y, int16_t vx, int16_t vy, uint8_t life, const uint8_t* color);
+	void emitRow(int8_t y, const uint8_t* color);
+	bool isActive();
+	void clear();
+	void update();
+	void draw(canvas canvas);
+
+private:
+
+	uint8_t _width;
+	uint8_t _height;
+	uint8_t _count; // live particles are kept at the front of the pool
+
+	// structure of arrays, position and velocity in 8.8 fixed-point
+	int16_t _x[PARTICLE_POOL_SIZE];
+	int16_t _y[PARTICLE_POOL_SIZE];
+	int16_t _vx[PARTICLE_POOL_SIZE];
+	int16_t _vy[PARTICLE_POOL_SIZE];
+	uint8_t _life[PARTICLE_POOL_SIZE]; // remaining frames
+	uint8_t _r[PARTICLE_POOL_SIZE];
+	uint8_t _g[PARTICLE_POOL_SIZE];
+	uint8_t _b[PARTICLE_POOL_SIZE];
+
+	void _remove(uint8_t idx);
+};
+
+#endif
@@ -0,0 +1,116 @@
+//============================================================================
+// Portable PMF mixer, see pmf_mixer.h
+//============================================================================
+
+#include "pmf_mixer.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+//---------------------------------------------------------------------------
+
+
+//===========================================================================
+// local
+//===========================================================================
+namespace
+{
+  enum {mix_lanes=8};
+  //-------------------------------------------------------------------------
+
+  inline int16_t scale_sample(int8_t smp_, uint8_t volume_)
+  {
+    // high byte of the mulsu product
+    return int16_t(int16_t(smp_)*volume_)>>8;
+  }
+  //----
+
+  // advances past the sample just mixed, returns false when the sample ended
+  inline bool advance(pmf_mixer_channel &chl_, uint32_t speed_)
+  {
+    chl_.pos+=speed_;
+    if((chl_.pos>>8)<chl_.length)
+      return true;
+    chl_.pos-=uint32_t(chl_.loop_length)<<8;
+    if(chl_.loop_length)
+      return true;
+    chl_.speed=0;
+    return false;
+  }
+  //----
+
+#if defined(__SSE2__)
+  // mixes mix_lanes samples which all lie before the end of the sample
+  inline void mix_lanes_simd(int16_t *buffer_, const int8_t *data_, uint32_t pos_, uint32_t speed_, uint8_t volume_)
+  {
+#if defined(__AVX2__)
+    __m256i pos=_mm256_add_epi32(_mm256_set1_epi32(pos_), _mm256_mullo_epi32(_mm256_set1_epi32(speed_), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+    __m256i smp=_mm256_i32gather_epi32((const int*)data_, _mm256_srli_epi32(pos, 8), 1);
+    smp=_mm256_srai_epi32(_mm256_slli_epi32(smp, 24), 24);
+    __m256i scaled=_mm256_srai_epi32(_mm256_mullo_epi32(smp, _mm256_set1_epi32(volume_)), 8);
+    // pack works within 128 bit lanes, gather the two low halves afterwards
+    __m128i addend=_mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packs_epi32(scaled, scaled), 0x08));
+#else
+    int16_t smp[mix_lanes];
+    for(unsigned i=0; i<mix_lanes; ++i, pos_+=speed_)
+      smp[i]=data_[pos_>>8];
+    __m128i addend=_mm_srai_epi16(_mm_mullo_epi16(_mm_loadu_si128((const __m128i*)smp), _mm_set1_epi16(volume_)), 8);
+#endif
+    __m128i *dst=(__m128i*)buffer_;
+    _mm_storeu_si128(dst, _mm_add_epi16(_mm_loadu_si128(dst), addend));
+  }
+#endif
+} // namespace <anonymous>
+//---------------------------------------------------------------------------
+
+
+//===========================================================================
+// pmf_mix_channel
+//===========================================================================
+void pmf_mix_channel_scalar(int16_t *buffer_, unsigned num_samples_, pmf_mixer_channel &chl_)
+{
+  int16_t *buffer_end=buffer_+num_samples_;
+  uint32_t speed=chl_.speed;
+  do
+  {
+    *buffer_=int16_t(uint16_t(*buffer_)+uint16_t(scale_sample(chl_.data[chl_.pos>>8], chl_.volume)));
+    if(!advance(chl_, speed))
+      return;
+  } while(++buffer_!=buffer_end);
+}
+//----
+
+void pmf_mix_channel(int16_t *buffer_, unsigned num_samples_, pmf_mixer_channel &chl_)
+{
+#if defined(__SSE2__)
+  int16_t *buffer_end=buffer_+num_samples_;
+  uint32_t speed=chl_.speed;
+  while(buffer_end-buffer_>=mix_lanes)
+  {
+    // the gather reads 4 bytes from the position of the last lane
+    uint32_t last_pos=(chl_.pos+speed*(mix_lanes-1))>>8;
+    if(last_pos+3>=chl_.length)
+    {
+      // wrap ahead, mix up to it one sample at a time
+      *buffer_=int16_t(uint16_t(*buffer_)+uint16_t(scale_sample(chl_.data[chl_.pos>>8], chl_.volume)));
+      ++buffer_;
+      if(!advance(chl_, speed))
+        return;
+      continue;
+    }
+
+    mix_lanes_simd(buffer_, chl_.data, chl_.pos, speed, chl_.volume);
+    buffer_+=mix_lanes;
+    chl_.pos+=speed*(mix_lanes-1);
+    if(!advance(chl_, speed))
+      return;
+  }
+  if(buffer_!=buffer_end)
+    pmf_mix_channel_scalar(buffer_, unsigned(buffer_end-buffer_), chl_);
+#else
+  pmf_mix_channel_scalar(buffer_, num_samples_, chl_);
+#endif
+}
+//---------------------------------------------------------------------------
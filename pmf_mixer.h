@@ -0,0 +1,39 @@
+//============================================================================
+// Portable PMF mixer
+//
+// C++ version of the AVR inline assembly mixing loop in
+// pmf_player_arduino.cpp, producing identical results: samples are scaled by
+// the high byte of the signed 8x8 bit product (mulsu), the position advances
+// by an 8.8 speed and wraps back by the loop length once it passes the end
+// of the sample. Hosts with SSE2 or AVX2 mix 8 samples at a time between
+// wraps.
+//============================================================================
+
+#ifndef PFC_PMF_MIXER_H
+#define PFC_PMF_MIXER_H
+//---------------------------------------------------------------------------
+
+#include <stddef.h>
+#include <stdint.h>
+
+//===========================================================================
+// pmf_mixer_channel
+//===========================================================================
+struct pmf_mixer_channel
+{
+  const int8_t *data;   // first sample
+  uint32_t pos;         // sample position (24.8 fp)
+  uint16_t speed;       // sample speed (8.8 fp), cleared when a non-looping sample ends
+  uint16_t length;      // number of samples
+  uint16_t loop_length; // number of samples in the loop at the end of the sample, 0 if not looping
+  uint8_t volume;       // volume (0.8 fp)
+};
+//---------------------------------------------------------------------------
+
+// adds num_samples_ (at least 1) samples of the channel to the buffer
+void pmf_mix_channel(int16_t *buffer_, unsigned num_samples_, pmf_mixer_channel &chl_);
+void pmf_mix_channel_scalar(int16_t *buffer_, unsigned num_samples_, pmf_mixer_channel &chl_);
+//---------------------------------------------------------------------------
+
+//============================================================================
+#endif
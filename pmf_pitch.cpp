@@ -0,0 +1,118 @@
+//============================================================================
+// PMF pitch tables, see pmf_pitch.h
+//============================================================================
+
+#include "pmf_pitch.h"
+#include "pmf_player.h"
+//---------------------------------------------------------------------------
+
+
+//===========================================================================
+// tables
+//===========================================================================
+// Amiga note periods, round(27392/2^(n/12))
+static const uint16_t PROGMEM s_note_periods[pmfcfg_num_note_periods]=
+{
+  27392, 25855, 24403, 23034, 21741, 20521, 19369, 18282, 17256, 16287, 15373, 14510,
+  13696, 12927, 12202, 11517, 10871, 10260,  9685,  9141,  8628,  8144,  7687,  7255,
+   6848,  6464,  6101,  5758,  5435,  5130,  4842,  4570,  4314,  4072,  3843,  3628,
+   3424,  3232,  3050,  2879,  2718,  2565,  2421,  2285,  2157,  2036,  1922,  1814,
+   1712,  1616,  1525,  1440,  1359,  1283,  1211,  1143,  1078,  1018,   961,   907,
+    856,   808,   763,   720,   679,   641,   605,   571,   539,   509,   480,   453,
+    428,   404,   381,   360,   340,   321,   303,   286,   270,   254,   240,   227,
+    214,   202,   191,   180,   170,   160,   151,   143,   135,   127,   120,   113,
+    107,   101,    95,    90,    85,    80,    76,    71,    67,    64,    60,    57,
+     54,    50,    48,    45,    42,    40,    38,    36,    34,    32,    30,    28,
+     27,    25,    24,    22,    21,    20,    19,    18,    17,    16,    15,    14,
+     13,    13,    12,    11,    11,    10,     9,     9,     8,     8,     8,     7
+};
+// one octave of linear frequency table speeds for a 1 Hz C-4 sample,
+// round(2^(i/96)*32/sampling_rate*2^24), interpolated over 8 period units
+static const uint16_t PROGMEM s_linear_speeds[97]=
+{
+  24348, 24524, 24702, 24881, 25061, 25243, 25426, 25610, 25796, 25983, 26171, 26361,
+  26552, 26744, 26938, 27133, 27330, 27528, 27727, 27928, 28130, 28334, 28540, 28746,
+  28955, 29164, 29376, 29589, 29803, 30019, 30237, 30456, 30676, 30899, 31123, 31348,
+  31575, 31804, 32035, 32267, 32501, 32736, 32973, 33212, 33453, 33695, 33939, 34185,
+  34433, 34683, 34934, 35187, 35442, 35699, 35958, 36218, 36481, 36745, 37011, 37279,
+  37550, 37822, 38096, 38372, 38650, 38930, 39212, 39496, 39782, 40071, 40361, 40654,
+  40948, 41245, 41544, 41845, 42148, 42453, 42761, 43071, 43383, 43697, 44014, 44333,
+  44654, 44978, 45304, 45632, 45963, 46296, 46631, 46969, 47310, 47652, 47998, 48345,
+  48696
+};
+// one octave of Amiga speeds for a 1 Hz C-4 sample at periods 16384+128*i,
+// round(1024*7093789.2/(8363*sampling_rate)*2^24/(16384+128*i)), periods
+// below the octave are scaled into it by powers of two
+static const uint16_t PROGMEM s_amiga_speeds[129]=
+{
+  40337, 40025, 39717, 39414, 39115, 38821, 38531, 38246, 37965, 37687, 37414, 37145,
+  36880, 36618, 36360, 36106, 35855, 35608, 35364, 35124, 34886, 34652, 34421, 34193,
+  33968, 33746, 33527, 33311, 33097, 32887, 32678, 32473, 32270, 32069, 31871, 31676,
+  31483, 31292, 31104, 30917, 30733, 30551, 30372, 30194, 30019, 29845, 29673, 29504,
+  29336, 29171, 29007, 28845, 28684, 28526, 28369, 28214, 28061, 27909, 27759, 27611,
+  27464, 27318, 27175, 27032, 26892, 26752, 26614, 26478, 26343, 26209, 26077, 25946,
+  25816, 25687, 25560, 25434, 25310, 25186, 25064, 24943, 24823, 24704, 24587, 24470,
+  24355, 24240, 24127, 24015, 23904, 23793, 23684, 23576, 23469, 23363, 23258, 23153,
+  23050, 22947, 22846, 22745, 22646, 22547, 22449, 22351, 22255, 22160, 22065, 21971,
+  21878, 21786, 21694, 21603, 21513, 21424, 21335, 21248, 21161, 21074, 20989, 20904,
+  20819, 20736, 20653, 20570, 20489, 20408, 20327, 20248, 20169
+};
+//---------------------------------------------------------------------------
+
+// both speed tables are generated for the 22050 Hz sampling rate
+static const uint16_t s_linear_octave_periods=768;
+//---------------------------------------------------------------------------
+
+
+//===========================================================================
+// pmf_get_note_period
+//===========================================================================
+uint16_t pmf_get_note_period(uint8_t note_idx_, bool linear_freq_table_)
+{
+  if(linear_freq_table_)
+    return 7680-note_idx_*64;
+  if(note_idx_>=pmfcfg_num_note_periods)
+    note_idx_=pmfcfg_num_note_periods-1;
+  return pgm_read_word(s_note_periods+note_idx_);
+}
+//----
+
+//===========================================================================
+// pmf_get_sample_speed
+//===========================================================================
+uint16_t pmf_get_sample_speed(uint16_t note_period_, uint16_t c4hz_, bool linear_freq_table_)
+{
+  if(linear_freq_table_)
+  {
+    // split the period into an octave and a position within it, periods
+    // above the C-0 one are clamped to it
+    uint16_t x=note_period_<7680?7680-note_period_:0;
+    uint8_t octave=(x>>8)/3;
+    uint16_t frac=x-octave*s_linear_octave_periods;
+    uint8_t idx=frac>>3, weight=frac&7;
+    uint16_t speed_lo=pgm_read_word(s_linear_speeds+idx), speed_hi=pgm_read_word(s_linear_speeds+idx+1);
+    uint16_t speed=speed_lo+(((speed_hi-speed_lo)*weight)>>3);
+    uint8_t shift=24-octave;
+    return uint16_t((uint32_t(c4hz_)*speed+(uint32_t(1)<<(shift-1)))>>shift);
+  }
+
+  // scale the period into the table octave, halving the period doubles the
+  // speed
+  if(note_period_<pmf_min_period)
+    note_period_=pmf_min_period;
+  if(note_period_>0x7fff)
+    note_period_=0x7fff;
+  uint8_t octave=0;
+  while(note_period_<0x4000)
+  {
+    note_period_<<=1;
+    ++octave;
+  }
+  uint16_t frac=note_period_-0x4000;
+  uint8_t idx=frac>>7, weight=frac&127;
+  uint16_t speed_lo=pgm_read_word(s_amiga_speeds+idx), speed_hi=pgm_read_word(s_amiga_speeds+idx+1);
+  uint16_t speed=speed_lo-(((speed_lo-speed_hi)*weight)>>7);
+  uint8_t shift=24-octave;
+  return uint16_t((uint32_t(c4hz_)*speed+(uint32_t(1)<<(shift-1)))>>shift);
+}
+//---------------------------------------------------------------------------
@@ -0,0 +1,24 @@
+//============================================================================
+// PMF pitch tables
+//
+// Fixed-point note periods and sample speeds for the Amiga and linear
+// frequency tables, replacing the float exp2() approximation of the player.
+//============================================================================
+
+#ifndef PFC_PMF_PITCH_H
+#define PFC_PMF_PITCH_H
+//---------------------------------------------------------------------------
+
+#include <Arduino.h>
+
+// covers any note (7 bits) plus an arpeggio offset (4 bits)
+enum {pmfcfg_num_note_periods=144};
+enum {pmf_min_period=28, pmf_max_period=27392};
+//---------------------------------------------------------------------------
+
+uint16_t pmf_get_note_period(uint8_t note_idx_, bool linear_freq_table_);
+uint16_t pmf_get_sample_speed(uint16_t note_period_, uint16_t c4hz_, bool linear_freq_table_);
+//---------------------------------------------------------------------------
+
+//============================================================================
+#endif
@@ -28,6 +28,7 @@
 //============================================================================
 
 #include "pmf_player.h"
+#include "pmf_pitch.h"
 #include "pmf_data.h"
 //---------------------------------------------------------------------------
 
@@ -58,6 +59,7 @@ struct pmf_header
 // PMF config
 // PMF file structure
 enum {pmfcfg_offset_flags=PFC_OFFSETOF(pmf_header, flags)};
+enum {pmfcfg_offset_file_size=PFC_OFFSETOF(pmf_header, file_size)};
 enum {pmfcfg_offset_init_speed=PFC_OFFSETOF(pmf_header, initial_speed)};
 enum {pmfcfg_offset_init_tempo=PFC_OFFSETOF(pmf_header, initial_tempo)};
 enum {pmfcfg_offset_playlist_length=PFC_OFFSETOF(pmf_header, playlist_length)};
@@ -80,6 +82,16 @@ enum {pmfcfg_offset_env_point_pos=0};
 enum {pmfcfg_offset_env_point_val=1};
 //enum {pmfcfg_envelope_header_size=5};
 enum {pmfcfg_envelope_point_size=2};
+// seek index configs
+enum {pmfcfg_offset_seek_file_size=0};         // low word of the indexed file size
+enum {pmfcfg_offset_seek_rows_per_snapshot=2};
+enum {pmfcfg_offset_seek_num_channels=3};
+enum {pmfcfg_offset_seek_pattern_offsets=4};   // per pattern offset of its first snapshot
+enum {pmfcfg_seek_pattern_offset_size=2};
+enum {pmfcfg_offset_seek_track_offset=0};
+enum {pmfcfg_offset_seek_track_bit_pos=2};
+enum {pmfcfg_offset_seek_decomp_buf=3};
+enum {pmfcfg_seek_snapshot_channel_size=15};
 // bit-compression settings
 enum {pmfcfg_num_data_mask_bits=4};
 enum {pmfcfg_num_note_bits=7};       // max 10 octaves (0-9) (12*10=120)
@@ -98,7 +110,7 @@ enum {pmfcfg_note_cut=120};
 enum {pmfcfg_note_off=121};
 // PMF effects
 enum {num_subfx_value_bits=4};
-enum {subfx_value_mask=~(-1<<num_subfx_value_bits)};
+enum {subfx_value_mask=(1<<num_subfx_value_bits)-1};
 enum e_pmf_effect
 {
   // global control
@@ -147,7 +159,7 @@ static const uint8_t PROGMEM s_waveforms[3][32]=
 //===========================================================================
 // PMF note periods
 //===========================================================================
-enum {min_period=28, max_period=27392};
+enum {min_period=pmf_min_period, max_period=pmf_max_period};
 //---------------------------------------------------------------------------
 
 
@@ -173,51 +185,21 @@ namespace
   }
   //-------------------------------------------------------------------------
 
-  //=========================================================================
-  // exp2
-  //=========================================================================
-  float exp2(float x_)
-  {
-    // map x_ to range [0, 0.5]
-    int adjustment=0;
-    uint8_t int_arg=uint8_t(x_);
-    x_-=int_arg;
-    if(x_>0.5f)
-    {
-      adjustment=1;
-      x_-=0.5f;
-    }
-
-    // calculate 2^x_ approximation
-    float x2=x_*x_;
-    float Q=20.8189237930062f+x2;
-    float x_P=x_*(7.2152891521493f+0.0576900723731f*x2);
-    float res=(1<<int_arg)*(Q+x_P)/(Q-x_P);
-    if(adjustment)
-      res*=1.4142135623730950488f;
-    return res;
-  }
-  //-------------------------------------------------------------------------
-
   //=========================================================================
   // get_note_period
   //=========================================================================
-  uint16_t get_note_period(uint8_t note_idx_, uint8_t flags_)
+  inline uint16_t get_note_period(uint8_t note_idx_, uint8_t flags_)
   {
-    if(flags_&pmfflag_linear_freq_table)
-      return 7680-note_idx_*64;
-    return uint16_t(27392.0f/exp2(note_idx_/12.0f)+0.5f);
+    return pmf_get_note_period(note_idx_, (flags_&pmfflag_linear_freq_table)!=0);
   }
   //-------------------------------------------------------------------------
 
   //=========================================================================
   // get_sample_speed
   //=========================================================================
-  uint16_t get_sample_speed(uint16_t note_period_, uint16_t c4hz_, uint8_t flags_)
+  inline uint16_t get_sample_speed(uint16_t note_period_, uint16_t c4hz_, uint8_t flags_)
   {
-    if(flags_&pmfflag_linear_freq_table)
-      return uint16_t((c4hz_*32.0f/pmfplayer_sampling_rate)*exp2(float(7680-note_period_)/768.0f)+0.5f);
-    return uint16_t((c4hz_*1024.0f*7093789.2/pmfplayer_sampling_rate)/(8363.0f*note_period_)+0.5f);
+    return pmf_get_sample_speed(note_period_, c4hz_, (flags_&pmfflag_linear_freq_table)!=0);
   }
 } // namespace <anonymous>
 //---------------------------------------------------------------------------
@@ -228,6 +210,11 @@ namespace
 //===========================================================================
 pmf_player::pmf_player()
 {
+  m_num_playback_channels=0;
+  m_max_mix_channels=0;
+  m_music_playing=false;
+  memset(m_sfx_voices, 0, sizeof(m_sfx_voices));
+  reset_stats();
 }
 //----
 
@@ -237,7 +224,7 @@ pmf_player::~pmf_player()
 }
 //---------------------------------------------------------------------------
 
-void pmf_player::start(const void *pmem_pmf_file_)
+void pmf_player::start(const void *pmem_pmf_file_, const void *pmem_seek_index_)
 {
   // read PMF properties
   m_pmf_file=static_cast<const uint8_t*>(pmem_pmf_file_);
@@ -248,6 +235,13 @@ void pmf_player::start(const void *pmem_pmf_file_)
   m_pmf_pattern_meta=m_pmf_instrument_meta+sizeof(pmf_instrument_header)*pgm_read_byte(m_pmf_file+pmfcfg_offset_num_instruments);
   m_note_slide_speed=m_flags&pmfflag_fast_note_slides?4:2;
 
+  // use the seek index only if it was built for this file
+  m_seek_index=static_cast<const uint8_t*>(pmem_seek_index_);
+  if(   m_seek_index
+     && (   pgm_read_word(m_seek_index+pmfcfg_offset_seek_file_size)!=pgm_read_word(m_pmf_file+pmfcfg_offset_file_size)
+         || pgm_read_byte(m_seek_index+pmfcfg_offset_seek_num_channels)!=m_num_playback_channels))
+    m_seek_index=0;
+
   // initialize channels
   memset(m_channels, 0, sizeof(m_channels));
   for(unsigned ci=0; ci<m_num_playback_channels; ++ci)
@@ -266,53 +260,230 @@ void pmf_player::start(const void *pmem_pmf_file_)
 
   // start playback
   m_batch_pos=0;
-  start_playback();
+  m_music_playing=true;
+}
+//----
+
+void pmf_player::seek(uint8_t playlist_pos_, uint8_t row_)
+{
+  // play the row on the next tick
+  init_pattern(playlist_pos_, row_);
+  m_current_row_tick=m_speed-1;
+  m_pattern_delay=1;
+  m_batch_pos=0;
+}
+//----
+
+#if !defined(__AVR__)
+unsigned pmf_player::build_seek_index(uint8_t *index_, unsigned index_size_, uint8_t rows_per_snapshot_)
+{
+  // write index header
+  uint8_t num_patterns=pgm_read_byte(m_pmf_file+pmfcfg_offset_num_patterns);
+  unsigned size=pmfcfg_offset_seek_pattern_offsets+num_patterns*pmfcfg_seek_pattern_offset_size;
+  if(!rows_per_snapshot_ || size>index_size_)
+    return 0;
+  uint16_t file_size=pgm_read_word(m_pmf_file+pmfcfg_offset_file_size);
+  index_[pmfcfg_offset_seek_file_size]=uint8_t(file_size);
+  index_[pmfcfg_offset_seek_file_size+1]=uint8_t(file_size>>8);
+  index_[pmfcfg_offset_seek_rows_per_snapshot]=rows_per_snapshot_;
+  index_[pmfcfg_offset_seek_num_channels]=m_num_playback_channels;
+
+  // decode all patterns from the start and snapshot the tracks every few rows
+  for(uint8_t pi=0; pi<num_patterns; ++pi)
+  {
+    uint8_t *pattern_offset=index_+pmfcfg_offset_seek_pattern_offsets+pi*pmfcfg_seek_pattern_offset_size;
+    pattern_offset[0]=uint8_t(size);
+    pattern_offset[1]=uint8_t(size>>8);
+    const uint8_t *pattern=m_pmf_pattern_meta+pi*(pmfcfg_pattern_metadata_header_size+pmfcfg_pattern_metadata_track_offset_size*m_num_pattern_channels);
+    uint8_t last_row=pgm_read_byte(pattern+pmfcfg_offset_pattern_metadata_last_row);
+    audio_channel channels[pmfplayer_max_channels];
+    memset(channels, 0, sizeof(channels));
+    for(uint8_t ci=0; ci<m_num_playback_channels; ++ci)
+    {
+      audio_channel &chl=channels[ci];
+      chl.track_pos=m_pmf_file+pgm_read_word(pattern+pmfcfg_offset_pattern_metadata_track_offsets+ci*pmfcfg_pattern_metadata_track_offset_size);
+      chl.decomp_type=read_bits(chl.track_pos, chl.track_bit_pos, 3)&7;
+    }
+    for(unsigned ri=0; ri<last_row; ++ri)
+    {
+      uint8_t note_idx, inst_idx, volume, effect, effect_data;
+      for(uint8_t ci=0; ci<m_num_playback_channels; ++ci)
+        process_track_row(channels[ci], note_idx, inst_idx, volume, effect, effect_data);
+      if((ri+1)%rows_per_snapshot_)
+        continue;
+
+      // snapshot for row ri+1
+      if(size+m_num_playback_channels*pmfcfg_seek_snapshot_channel_size>index_size_ || size>0xffff)
+        return 0;
+      for(uint8_t ci=0; ci<m_num_playback_channels; ++ci)
+      {
+        const audio_channel &chl=channels[ci];
+        uint8_t *snapshot=index_+size;
+        uint16_t track_offset=uint16_t(chl.track_pos-m_pmf_file);
+        snapshot[pmfcfg_offset_seek_track_offset]=uint8_t(track_offset);
+        snapshot[pmfcfg_offset_seek_track_offset+1]=uint8_t(track_offset>>8);
+        snapshot[pmfcfg_offset_seek_track_bit_pos]=chl.track_bit_pos;
+        memcpy(snapshot+pmfcfg_offset_seek_decomp_buf, chl.decomp_buf, sizeof(chl.decomp_buf));
+        size+=pmfcfg_seek_snapshot_channel_size;
+      }
+    }
+  }
+  return size;
 }
 //----
+#endif
 
 void pmf_player::stop()
 {
-  stop_playback();
+  // the interrupt keeps playing the buffer for the sound effects
+  m_music_playing=false;
 }
 //----
 
-void pmf_player::update()
+bool pmf_player::play_sfx(const void *pmem_wave_, uint16_t size_, uint8_t priority_)
+{
+  // pick a free voice, or steal the lowest priority one closest to its end
+  sfx_voice *voice=0;
+  for(uint8_t vi=0; vi<pmfplayer_max_sfx_voices; ++vi)
+  {
+    sfx_voice &v=m_sfx_voices[vi];
+    if(v.pos>=v.size)
+    {
+      voice=&v;
+      break;
+    }
+    if(   v.priority<=priority_
+       && (   !voice
+           || v.priority<voice->priority
+           || (v.priority==voice->priority && v.size-v.pos<voice->size-voice->pos)))
+      voice=&v;
+  }
+  if(!voice)
+    return false;
+
+  // start the sound effect
+  voice->data=static_cast<const uint8_t*>(pmem_wave_);
+  voice->size=size_;
+  voice->pos=0;
+  voice->priority=priority_;
+  return true;
+}
+//----
+
+void pmf_player::set_max_mix_channels(uint8_t num_channels_)
+{
+  m_max_mix_channels=num_channels_;
+}
+//----
+
+uint8_t pmf_player::num_playback_channels() const
+{
+  return m_num_playback_channels;
+}
+//----
+
+uint8_t pmf_player::playlist_pos() const
+{
+  return m_current_pattern_playlist_pos;
+}
+//----
+
+uint8_t pmf_player::pattern_row() const
+{
+  return m_current_pattern_row_idx;
+}
+//----
+
+const pmf_audio_stats &pmf_player::stats() const
 {
-  // check if audio buffer should be updated
-  mixer_buffer subbuffer=get_mixer_buffer();
-  if(!subbuffer.num_samples)
-    return;
+  return m_stats;
+}
+//----
 
-  // update audio buffer
-  do
+void pmf_player::reset_stats()
+{
+  m_stats.num_underruns=0;
+  m_stats.num_late_refills=0;
+  m_stats.min_buffered_samples=0xffff;
+  m_stats.max_buffered_samples=0;
+  m_stats.max_isr_cycles=0;
+}
+//----
+
+uint8_t pmf_player::num_mix_channels() const
+{
+  // channels above the limit keep being processed but are not heard
+  return m_max_mix_channels && m_max_mix_channels<m_num_playback_channels?m_max_mix_channels:m_num_playback_channels;
+}
+//----
+
+void pmf_player::update()
+{
+  // refill all audio buffer segments the output has played
+  for(;;)
   {
-    // mix batch of samples
-    uint16_t batch_left=m_num_batch_samples-m_batch_pos;
-    unsigned num_samples=min(subbuffer.num_samples, batch_left);
-    mix_buffer(subbuffer, num_samples);
-    m_batch_pos+=num_samples;
-
-    // check for new batch
-    if(m_batch_pos==m_num_batch_samples)
+    mixer_buffer subbuffer=get_mixer_buffer();
+    if(!subbuffer.num_samples)
+      return;
+
+    // mix sound effects over the whole subbuffer, the music batches follow
+    mix_sfx_voices(subbuffer);
+    if(!m_music_playing)
+      continue;
+
+    // update audio buffer
+    do
     {
-      if(++m_current_row_tick==m_speed)
+      // mix batch of samples
+      uint16_t batch_left=m_num_batch_samples-m_batch_pos;
+      unsigned num_samples=min(subbuffer.num_samples, batch_left);
+      mix_buffer(subbuffer, num_samples);
+      m_batch_pos+=num_samples;
+
+      // check for new batch
+      if(m_batch_pos==m_num_batch_samples)
       {
-        if(!--m_pattern_delay)
+        if(++m_current_row_tick==m_speed)
         {
-          m_pattern_delay=1;
-          process_pattern_row();
+          if(!--m_pattern_delay)
+          {
+            m_pattern_delay=1;
+            process_pattern_row();
+          }
+          m_current_row_tick=0;
         }
-        m_current_row_tick=0;
+        else
+          apply_channel_effects();
+        evaluate_envelopes();
+        m_batch_pos=0;
       }
-      else
-        apply_channel_effects();
-      evaluate_envelopes();
-      m_batch_pos=0;
-    }
-  } while(subbuffer.num_samples);
+    } while(subbuffer.num_samples);
+  }
 }
 //---------------------------------------------------------------------------
 
+void pmf_player::mix_sfx_voices(const mixer_buffer &buf_)
+{
+  for(uint8_t vi=0; vi<pmfplayer_max_sfx_voices; ++vi)
+  {
+    // check for active voice
+    sfx_voice &voice=m_sfx_voices[vi];
+    if(voice.pos>=voice.size)
+      continue;
+
+    // add unsigned samples at half the DAC range, as the old mixin did
+    uint16_t num_samples=min(uint16_t(voice.size-voice.pos), uint16_t(buf_.num_samples));
+    const uint8_t *data=voice.data+voice.pos;
+    int16_t *buffer=(int16_t*)buf_.begin, *buffer_end=buffer+num_samples;
+    do
+    {
+      *buffer+=int8_t(pgm_read_byte(data++)^0x80)*(1<<(PMF_AUDIO_LEVEL-1));
+    } while(++buffer!=buffer_end);
+    voice.pos+=num_samples;
+  }
+}
+//----
+
 void pmf_player::apply_channel_effects()
 {
   m_arpeggio_counter=(m_arpeggio_counter+1)%3;
@@ -377,7 +548,7 @@ void pmf_player::apply_channel_effects()
       {
         uint8_t wave_idx=chl.fxmem_vibrato_wave&3;
         int8_t vibrato_pos=chl.fxmem_vibrato_pos;
-        int8_t wave_sample=vibrato_pos<0?-int8_t(pgm_read_byte(&s_waveforms[wave_idx][32-vibrato_pos])):pgm_read_byte(&s_waveforms[wave_idx][vibrato_pos]);
+        int8_t wave_sample=vibrato_pos<0?-int8_t(pgm_read_byte(&s_waveforms[wave_idx][32+vibrato_pos])):pgm_read_byte(&s_waveforms[wave_idx][vibrato_pos]);
         chl.sample_speed=get_sample_speed(chl.note_period+(int16_t(wave_sample*chl.fxmem_vibrato_depth)>>8), chl.sample_c4hz, m_flags);
         if((chl.fxmem_vibrato_pos+=chl.fxmem_vibrato_spd)>31)
           chl.fxmem_vibrato_pos-=64;
@@ -422,18 +593,20 @@ void pmf_player::evaluate_envelopes()
   // evaluate channel envelopes
   for(uint8_t ci=0; ci<m_num_playback_channels; ++ci)
   {
-    // check fadeout
+    // skip channels which did not get an instrument yet
     audio_channel &chl=m_channels[ci];
+    if(!chl.inst_metadata)
+      continue;
+
+    // check fadeout
     uint8_t volume=255;
     if(uint16_t env_offset=pgm_read_word(chl.inst_metadata+pmfcfg_offset_inst_vol_env))
     {
       // advance envelope
-      const uint8_t *envelope=m_pmf_file+env_offset;
-      const uint8_t *env_span_data=envelope+pmfcfg_offset_env_points+chl.vol_env_pos*pmfcfg_envelope_point_size;
-      uint8_t env_span_pos_end=pgm_read_byte(env_span_data+pmfcfg_offset_env_point_pos+pmfcfg_envelope_point_size);
-      if(++chl.vol_env_tick>env_span_pos_end)
+      if(++chl.vol_env_tick>chl.vol_env_span_end)
       {
         // get envelope start and end points (sustain/loop/none)
+        const uint8_t *envelope=m_pmf_file+env_offset;
         uint8_t env_last_pnt=pgm_read_byte(envelope+pmfcfg_offset_env_num_points)-1;
         uint8_t loop_pnt_start=pgm_read_byte(envelope+pmfcfg_offset_env_loop_start);
         uint8_t env_pnt_start=min(env_last_pnt, loop_pnt_start);
@@ -461,15 +634,40 @@ void pmf_player::evaluate_envelopes()
             chl.vol_env_tick=pgm_read_byte(envelope+pmfcfg_offset_env_points+pmfcfg_offset_env_point_pos+env_pnt_start*pmfcfg_envelope_point_size);
           }
         }
-        env_span_data=envelope+pmfcfg_offset_env_points+chl.vol_env_pos*pmfcfg_envelope_point_size;
-      }
 
-      // linearly interpolate envelope value
-      uint8_t env_span_pos_start=pgm_read_byte(env_span_data+pmfcfg_offset_env_point_pos);
-      uint8_t env_span_val_start=pgm_read_byte(env_span_data+pmfcfg_offset_env_point_val);
-      uint8_t env_span_val_end=pgm_read_byte(env_span_data+pmfcfg_offset_env_point_val+pmfcfg_envelope_point_size);
-      float span_pos=float(chl.vol_env_tick-env_span_pos_start)/float(env_span_pos_end-env_span_pos_start);
-      volume=env_span_val_start+int16_t(span_pos*(int16_t(env_span_val_end)-int16_t(env_span_val_start)));
+        // setup the new span. the slope is rounded away from zero so that
+        // the truncated level matches v0+(v1-v0)*t/len exactly for spans up
+        // to 255 ticks. spans without length (sustain point) hold the end value
+        const uint8_t *env_span_data=envelope+pmfcfg_offset_env_points+chl.vol_env_pos*pmfcfg_envelope_point_size;
+        uint8_t env_span_pos_start=pgm_read_byte(env_span_data+pmfcfg_offset_env_point_pos);
+        uint8_t env_span_pos_end=pgm_read_byte(env_span_data+pmfcfg_offset_env_point_pos+pmfcfg_envelope_point_size);
+        uint8_t env_span_val_start=pgm_read_byte(env_span_data+pmfcfg_offset_env_point_val);
+        uint8_t env_span_val_end=pgm_read_byte(env_span_data+pmfcfg_offset_env_point_val+pmfcfg_envelope_point_size);
+        chl.vol_env_span_end=env_span_pos_end;
+        if(env_span_pos_end<=env_span_pos_start)
+        {
+          chl.vol_env_slope=0;
+          chl.vol_env_level=uint32_t(env_span_val_end)<<16;
+        }
+        else
+        {
+          uint8_t span_len=env_span_pos_end-env_span_pos_start;
+          if(env_span_val_end>=env_span_val_start)
+          {
+            chl.vol_env_slope=(uint32_t(env_span_val_end-env_span_val_start)*65536+span_len-1)/span_len;
+            chl.vol_env_level=uint32_t(env_span_val_start)<<16;
+          }
+          else
+          {
+            chl.vol_env_slope=-int32_t((uint32_t(env_span_val_start-env_span_val_end)*65536+span_len-1)/span_len);
+            chl.vol_env_level=(uint32_t(env_span_val_start)<<16)+0xffff;
+          }
+          chl.vol_env_level+=chl.vol_env_slope*uint8_t(chl.vol_env_tick-env_span_pos_start);
+        }
+      }
+      else
+        chl.vol_env_level+=chl.vol_env_slope;
+      volume=chl.vol_env_level>>16;
     }
 
     // check volume fadeout
@@ -669,7 +867,7 @@ void pmf_player::process_pattern_row()
           {
             uint8_t wave_idx=chl.fxmem_vibrato_wave&3;
             int8_t vibrato_pos=chl.fxmem_vibrato_pos;
-            int8_t wave_sample=vibrato_pos<0?-int8_t(pgm_read_byte(&s_waveforms[wave_idx][32-vibrato_pos])):pgm_read_byte(&s_waveforms[wave_idx][vibrato_pos]);
+            int8_t wave_sample=vibrato_pos<0?-int8_t(pgm_read_byte(&s_waveforms[wave_idx][32+vibrato_pos])):pgm_read_byte(&s_waveforms[wave_idx][vibrato_pos]);
             if(chl.sample_speed)
               chl.sample_speed=get_sample_speed(chl.note_period+(int16_t(wave_sample*chl.fxmem_vibrato_depth)>>8), chl.sample_c4hz, m_flags);
             if((chl.fxmem_vibrato_pos+=chl.fxmem_vibrato_spd)>31)
@@ -758,6 +956,7 @@ void pmf_player::process_pattern_row()
       chl.note_hit=1;
       chl.vol_env_tick=0;
       chl.vol_env_pos=-1;
+      chl.vol_env_span_end=0;
     }
   }
 
@@ -877,8 +1076,24 @@ void pmf_player::init_pattern(uint8_t playlist_pos_, uint8_t row_)
   m_pattern_loop_row_idx=0;
 
   // initialize pattern at given playlist location and pattern row
-  const uint8_t *pattern=m_pmf_pattern_meta+pgm_read_byte(m_pmf_file+pmfcfg_offset_playlist+playlist_pos_)*(pmfcfg_pattern_metadata_header_size+pmfcfg_pattern_metadata_track_offset_size*m_num_pattern_channels);
+  uint8_t pattern_idx=pgm_read_byte(m_pmf_file+pmfcfg_offset_playlist+playlist_pos_);
+  const uint8_t *pattern=m_pmf_pattern_meta+pattern_idx*(pmfcfg_pattern_metadata_header_size+pmfcfg_pattern_metadata_track_offset_size*m_num_pattern_channels);
   m_current_pattern_last_row=pgm_read_byte(pattern+pmfcfg_offset_pattern_metadata_last_row);
+
+  // find the closest seek index snapshot before the row
+  const uint8_t *snapshot=0;
+  uint8_t snapshot_row=0;
+  if(m_seek_index)
+  {
+    uint8_t rows_per_snapshot=pgm_read_byte(m_seek_index+pmfcfg_offset_seek_rows_per_snapshot);
+    if(uint8_t snapshot_idx=min(row_, m_current_pattern_last_row)/rows_per_snapshot)
+    {
+      snapshot_row=snapshot_idx*rows_per_snapshot;
+      snapshot= m_seek_index+pgm_read_word(m_seek_index+pmfcfg_offset_seek_pattern_offsets+pattern_idx*pmfcfg_seek_pattern_offset_size)
+               +(snapshot_idx-1)*m_num_playback_channels*pmfcfg_seek_snapshot_channel_size;
+    }
+  }
+
   for(unsigned ci=0; ci<m_num_playback_channels; ++ci)
   {
     // init audio track
@@ -889,9 +1104,19 @@ void pmf_player::init_pattern(uint8_t playlist_pos_, uint8_t row_)
     chl.track_loop_pos=chl.track_pos;
     chl.track_loop_bit_pos=chl.track_bit_pos;
 
+    // restore the track state at the snapshot row
+    if(snapshot)
+    {
+      chl.track_pos=m_pmf_file+pgm_read_word(snapshot+pmfcfg_offset_seek_track_offset);
+      chl.track_bit_pos=pgm_read_byte(snapshot+pmfcfg_offset_seek_track_bit_pos);
+      for(uint8_t i=0; i<sizeof(chl.decomp_buf); ++i)
+        (&chl.decomp_buf[0][0])[i]=pgm_read_byte(snapshot+pmfcfg_offset_seek_decomp_buf+i);
+      snapshot+=pmfcfg_seek_snapshot_channel_size;
+    }
+
     // skip to given row
     uint8_t note_idx, inst_idx, volume, effect, effect_data;
-    for(unsigned ri=0; ri<row_; ++ri)
+    for(unsigned ri=snapshot_row; ri<row_; ++ri)
       process_track_row(chl, note_idx, inst_idx, volume, effect, effect_data);
   }
 }
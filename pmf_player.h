@@ -49,6 +49,35 @@
 #define PMF_AUDIO_LEVEL 2
 enum {pmfplayer_sampling_rate=22050};    // playback frequency in Hz
 enum {pmfplayer_max_channels=16};        // maximum number of audio playback channels
+enum {pmfplayer_max_sfx_voices=3};       // maximum number of simultaneous sound effects
+// audio buffer ring. update() mixes up to segments-1 segments ahead of the
+// output, which is how long the loop may stall without an underrun. music
+// and sound effects are heard up to segments*size samples after mixing.
+//
+//   segments x size   RAM      stall tolerance   latency
+//   2 x 200            800 B    9.1 ms           18.1 ms
+//   3 x 200           1200 B   18.1 ms           27.2 ms
+//   4 x 128           1024 B   17.4 ms           23.2 ms
+//   4 x 200           1600 B   27.2 ms           36.3 ms
+//   8 x 128           2048 B   40.6 ms           46.4 ms
+//
+// smaller segments cost more per sample, every refill sets up all channels
+enum {pmfplayer_audio_segments=4};
+enum {pmfplayer_audio_segment_size=128}; // samples per segment
+//---------------------------------------------------------------------------
+
+
+//===========================================================================
+// pmf_audio_stats
+//===========================================================================
+struct pmf_audio_stats
+{
+  uint16_t num_underruns;        // buffer segments the interrupt played before they were mixed
+  uint16_t num_late_refills;     // refills started with less than a quarter segment left to play
+  uint16_t min_buffered_samples; // low-water mark of the mixed samples left to play at a refill
+  uint16_t max_buffered_samples; // high-water mark of the same, shows how far the ring actually fills
+  uint16_t max_isr_cycles;       // longest sample interrupt in CPU cycles, including its latency
+};
 //---------------------------------------------------------------------------
 
 
@@ -66,18 +95,39 @@ public:
   // player control
   void enable_output();
   void disable_output();
-  void start(const void *pmem_pmf_file_);
-  void mixin(const void *pmem_wave_, uint16_t size);
+  // the optional seek index is generated with build_seek_index() on the host
+  void start(const void *pmem_pmf_file_, const void *pmem_seek_index_=0);
+  // continues the music from the given playlist position and pattern row,
+  // speed, tempo and channel effects carry over from the current position
+  void seek(uint8_t playlist_pos_, uint8_t row_=0);
+  // plays an unsigned 8-bit PCM sound effect on a free voice, or steals the
+  // lowest priority voice. returns false if all voices play higher priorities
+  bool play_sfx(const void *pmem_wave_, uint16_t size_, uint8_t priority_=0);
   void stop();
   void update();
+  // mix only the first num_channels_ channels, 0 mixes all of them
+  void set_max_mix_channels(uint8_t num_channels_);
+  uint8_t num_playback_channels() const;
+  uint8_t num_mix_channels() const;
+  uint8_t playlist_pos() const;
+  uint8_t pattern_row() const;
+  // buffer health since the last reset_stats()
+  const pmf_audio_stats &stats() const;
+  void reset_stats();
+#if !defined(__AVR__)
+  // host only: renders the next 8-bit samples as the DAC would receive them
+  void render(uint8_t *output_, unsigned num_samples_);
+  // host only: builds the seek index of the started song with track snapshots
+  // every rows_per_snapshot_ rows. returns its size, 0 if it does not fit
+  unsigned build_seek_index(uint8_t *index_, unsigned index_size_, uint8_t rows_per_snapshot_);
+#endif
   //-------------------------------------------------------------------------
 
 private:
   struct audio_channel;
   struct mixer_buffer;
-  void start_playback();
-  void stop_playback();
   void mix_buffer(mixer_buffer&, unsigned num_samples_);
+  void mix_sfx_voices(const mixer_buffer&);
   mixer_buffer get_mixer_buffer();
   void apply_channel_effects();
   void evaluate_envelopes();
@@ -96,6 +146,18 @@ private:
   };
   //-------------------------------------------------------------------------
 
+  //=========================================================================
+  // sfx_voice
+  //=========================================================================
+  struct sfx_voice
+  {
+    const uint8_t *data;
+    uint16_t size;
+    uint16_t pos;
+    uint8_t priority;
+  };
+  //-------------------------------------------------------------------------
+
   //=========================================================================
   // audio_channel
   //=========================================================================
@@ -124,6 +186,9 @@ private:
     uint8_t vol_env_tick;          // volume envelope ticks
     int8_t vol_env_pos;            // volume envelope position
     uint8_t vol_env_value;         // volume envelope value
+    uint8_t vol_env_span_end;      // volume envelope current span end tick
+    uint32_t vol_env_level;        // volume envelope level (16.16 fp)
+    int32_t vol_env_slope;         // volume envelope level change per tick (16.16 fp)
     // track state
     const uint8_t *track_pos;
     uint8_t track_bit_pos;
@@ -141,12 +206,19 @@ private:
   const uint8_t *m_pmf_file;
   const uint8_t *m_pmf_pattern_meta;
   const uint8_t *m_pmf_instrument_meta;
+  const uint8_t *m_seek_index;
   uint8_t m_note_slide_speed;
   // audio channel states
   uint8_t m_num_playback_channels;
   uint8_t m_num_pattern_channels;
+  uint8_t m_max_mix_channels;
   uint16_t m_flags;  // e_pmf_flags
   audio_channel m_channels[pmfplayer_max_channels];
+  bool m_music_playing;
+  // sound effect voices
+  sfx_voice m_sfx_voices[pmfplayer_max_sfx_voices];
+  // audio buffer health
+  pmf_audio_stats m_stats;
   // audio buffer state
   uint16_t m_num_batch_samples;
   uint16_t m_batch_pos;
@@ -42,97 +42,108 @@
 //===========================================================================
 // audio buffer
 //===========================================================================
-enum {pmfplayer_audio_buffer_size=400};  // number of 16-bit samples in the buffer
-enum {audio_subbuffer_size=pmfplayer_audio_buffer_size/2};
+enum {pmfplayer_audio_buffer_size=pmfplayer_audio_segments*pmfplayer_audio_segment_size};  // number of 16-bit samples in the buffer
 static int16_t s_buffer[pmfplayer_audio_buffer_size];
 static int16_t *volatile s_buffer_playback_pos;
-static uint8_t s_subbuffer_write_idx=0;
+// ring slot and running number of the next segment to mix. running numbers
+// of the played segment follow from the interrupt's buffer restart count
+static uint8_t s_segment_write_idx=0;
+static uint16_t s_segment_write_count=0;
+static volatile uint16_t s_buffer_restarts=0;
+// buffer health, the interrupt keeps its longest run
+enum {late_refill_samples=pmfplayer_audio_segment_size/4};
+static volatile uint16_t s_isr_max_cycles=0;
 //---------------------------------------------------------------------------
 
-static bool pmf_playback;
 static volatile uint8_t output;
 static DAC_MCP4921 dac;
 
-static const uint8_t *mixin_wave;
-static uint16_t mixin_size = 0;
-static uint16_t mixin_pos = 0;
-
 //===========================================================================
 // pmf_player
 //===========================================================================
 ISR(TIMER1_COMPA_vect)
 {
-  if (pmf_playback) {
-	  static const int8_t s_mid_buffer_value_hi=1<<(PMF_AUDIO_LEVEL-1);
-	  int16_t smp;
-	  asm volatile
-	  (
-		"ld %A[smp], %a[buffer_pos] \n\t"
-		"st %a[buffer_pos]+, __zero_reg__ \n\t"
-		"ld %B[smp], %a[buffer_pos] \n\t"
-		"lds __tmp_reg__, %[mid_buffer_value_hi] \n\t"
-		"st %a[buffer_pos]+, __tmp_reg__ \n\t"
+  static const int8_t s_mid_buffer_value_hi=1<<(PMF_AUDIO_LEVEL-1);
+  int16_t smp;
+  asm volatile
+  (
+    "ld %A[smp], %a[buffer_pos] \n\t"
+    "st %a[buffer_pos]+, __zero_reg__ \n\t"
+    "ld %B[smp], %a[buffer_pos] \n\t"
+    "lds __tmp_reg__, %[mid_buffer_value_hi] \n\t"
+    "st %a[buffer_pos]+, __tmp_reg__ \n\t"
 
 #if PMF_AUDIO_LEVEL>1
-		"asr %B[smp] \n\t"
-		"ror %A[smp] \n\t"
+    "asr %B[smp] \n\t"
+    "ror %A[smp] \n\t"
 #endif
 #if PMF_AUDIO_LEVEL>2
-		"asr %B[smp] \n\t"
-		"ror %A[smp] \n\t"
+    "asr %B[smp] \n\t"
+    "ror %A[smp] \n\t"
 #endif
 #if PMF_AUDIO_LEVEL>3
-		"asr %B[smp] \n\t"
-		"ror %A[smp] \n\t"
+    "asr %B[smp] \n\t"
+    "ror %A[smp] \n\t"
 #endif
-		"asr %B[smp] \n\t"
-		"breq no_sample_clamp_%= \n\t"
-		"lsl %B[smp] \n\t"
-		"sbc %B[smp], %B[smp] \n\t "
-		"com %B[smp] \n\t"
-		"mov %[output], %B[smp] \n\t"
-		"rjmp check_buffer_restart_%= \n\t"
-
-		"restart_buffer_%=: \n\t"
-		"ldi %A[buffer_pos], lo8(%[buffer_begin]) \n\t"
-		"ldi %B[buffer_pos], hi8(%[buffer_begin]) \n\t"
-		"rjmp done_%= \n\t\n\t"
-
-		"no_sample_clamp_%=: \n\t"
-		"ror %A[smp] \n\t"
-		"mov %[output], %A[smp] \n\t"
-
-		"check_buffer_restart_%=: \n\t"
-		"cpi %A[buffer_pos], lo8(%[buffer_end]) \n\t"
-		"ldi %A[smp], hi8(%[buffer_end]) \n\t"
-		"cpc %B[buffer_pos], %A[smp] \n\t"
-		"breq restart_buffer_%= \n\t"
-
-		"done_%=: \n\t"
-
-		:[buffer_pos] "+e" (s_buffer_playback_pos)
-		,[smp] "=&r" (smp)
-		,[output] "=&r" (output)
-		:[buffer_begin] "p" (s_buffer)
-		,[buffer_end] "p" (s_buffer+pmfplayer_audio_buffer_size)
-		,[mid_buffer_value_hi] "X" (&s_mid_buffer_value_hi)
-	  );
-  } else {
-	  output = 127;
-  }
-
-  if (mixin_pos < mixin_size) {
-	  uint16_t temp = output;
-	  temp += pgm_read_byte(mixin_wave + mixin_pos);
-	  output = temp / 2;
-	  mixin_pos++;
-  }
+    "asr %B[smp] \n\t"
+    "breq no_sample_clamp_%= \n\t"
+    "lsl %B[smp] \n\t"
+    "sbc %B[smp], %B[smp] \n\t "
+    "com %B[smp] \n\t"
+    "mov %[output], %B[smp] \n\t"
+    "rjmp check_buffer_restart_%= \n\t"
+
+    "restart_buffer_%=: \n\t"
+    "lds %A[smp], %[buffer_restarts] \n\t"
+    "lds %B[smp], %[buffer_restarts]+1 \n\t"
+    "sec \n\t"
+    "adc %A[smp], __zero_reg__ \n\t"
+    "adc %B[smp], __zero_reg__ \n\t"
+    "sts %[buffer_restarts], %A[smp] \n\t"
+    "sts %[buffer_restarts]+1, %B[smp] \n\t"
+    "ldi %A[buffer_pos], lo8(%[buffer_begin]) \n\t"
+    "ldi %B[buffer_pos], hi8(%[buffer_begin]) \n\t"
+    "rjmp done_%= \n\t\n\t"
+
+    "no_sample_clamp_%=: \n\t"
+    "ror %A[smp] \n\t"
+    "mov %[output], %A[smp] \n\t"
+
+    "check_buffer_restart_%=: \n\t"
+    "cpi %A[buffer_pos], lo8(%[buffer_end]) \n\t"
+    "ldi %A[smp], hi8(%[buffer_end]) \n\t"
+    "cpc %B[buffer_pos], %A[smp] \n\t"
+    "breq restart_buffer_%= \n\t"
+
+    "done_%=: \n\t"
+
+    :[buffer_pos] "+e" (s_buffer_playback_pos)
+    ,[smp] "=&r" (smp)
+    ,[output] "=&r" (output)
+    :[buffer_begin] "p" (s_buffer)
+    ,[buffer_end] "p" (s_buffer+pmfplayer_audio_buffer_size)
+    ,[mid_buffer_value_hi] "X" (&s_mid_buffer_value_hi)
+    ,[buffer_restarts] "X" (&s_buffer_restarts)
+  );
 
   dac.output(((unsigned short) output) * 16);
+
+  // the timer restarts from 0 on the compare match that raised the interrupt
+  uint16_t cycles=TCNT1;
+  if(cycles>s_isr_max_cycles)
+    s_isr_max_cycles=cycles;
 }
 //----
 
 void pmf_player::enable_output() {
+	// clear audio buffer, the interrupt keeps playing it from now on
+	for(unsigned i=0; i<pmfplayer_audio_buffer_size; ++i)
+		s_buffer[i]=0x80<<PMF_AUDIO_LEVEL;
+	s_buffer_playback_pos=s_buffer;
+	s_segment_write_idx=1;
+	s_segment_write_count=1;
+	s_buffer_restarts=0;
+
 	dac.setSPIDivider(SPI_CLOCK_DIV2);
 
 	TCCR1A=0;
@@ -146,34 +157,10 @@ void pmf_player::disable_output() {
 	TIMSK1=0;
 }
 
-void pmf_player::start_playback()
-{
-  // clear audio buffer
-  for(unsigned i=0; i<pmfplayer_audio_buffer_size; ++i)
-    s_buffer[i]=0x80<<PMF_AUDIO_LEVEL;
-  s_buffer_playback_pos=s_buffer;
-  s_subbuffer_write_idx=1;
-
-  pmf_playback = true;
-}
-//----
-
-void pmf_player::stop_playback()
-{
-	pmf_playback = false;
-}
-//----
-
-void pmf_player::mixin(const void *pmem_wave_, uint16_t size) {
-	mixin_wave = static_cast<const uint8_t*>(pmem_wave_);
-	mixin_size = size;
-	mixin_pos = 0;
-}
-
 void pmf_player::mix_buffer(mixer_buffer &buf_, unsigned num_samples_)
 {
   int16_t *buffer_begin=(int16_t*)buf_.begin, *buffer_end=buffer_begin+num_samples_;
-  audio_channel *channel=m_channels, *channel_end=channel+m_num_playback_channels;
+  audio_channel *channel=m_channels, *channel_end=channel+num_mix_channels();
   do
   {
     // check for active channel
@@ -264,14 +251,44 @@ pmf_player::mixer_buffer pmf_player::get_mixer_buffer()
 {
   asm volatile("cli"::);
   const int16_t *playback_pos=s_buffer_playback_pos;
+  uint16_t buffer_restarts=s_buffer_restarts;
+  uint16_t isr_cycles=s_isr_max_cycles;
+  s_isr_max_cycles=0;
   asm volatile("sei"::);
+  if(isr_cycles>m_stats.max_isr_cycles)
+    m_stats.max_isr_cycles=isr_cycles;
+
+  // check how far the mixing runs ahead of the played segment
   mixer_buffer buf={0, 0};
-  if(   (s_subbuffer_write_idx && playback_pos>=s_buffer+audio_subbuffer_size)
-     || (!s_subbuffer_write_idx && playback_pos<s_buffer+audio_subbuffer_size))
+  uint8_t playback_segment_idx=uint16_t(playback_pos-s_buffer)/pmfplayer_audio_segment_size;
+  uint16_t playback_segment_count=buffer_restarts*pmfplayer_audio_segments+playback_segment_idx;
+  int16_t lead=int16_t(s_segment_write_count-playback_segment_count);
+  if(lead>=pmfplayer_audio_segments)
     return buf;
-  buf.begin=s_buffer+s_subbuffer_write_idx*audio_subbuffer_size;
-  buf.num_samples=audio_subbuffer_size;
-  s_subbuffer_write_idx^=1;
+  if(lead<=0)
+  {
+    // the interrupt overtook the mixing and played silence, continue after
+    // the segment it is playing
+    m_stats.num_underruns+=1-lead;
+    s_segment_write_count=playback_segment_count+1;
+    s_segment_write_idx=playback_segment_idx+1<pmfplayer_audio_segments?playback_segment_idx+1:0;
+  }
+  else
+  {
+    uint16_t num_buffered=(lead-1)*pmfplayer_audio_segment_size+(s_buffer+(playback_segment_idx+1)*pmfplayer_audio_segment_size-playback_pos);
+    if(num_buffered<late_refill_samples)
+      ++m_stats.num_late_refills;
+    if(num_buffered<m_stats.min_buffered_samples)
+      m_stats.min_buffered_samples=num_buffered;
+    if(num_buffered>m_stats.max_buffered_samples)
+      m_stats.max_buffered_samples=num_buffered;
+  }
+
+  buf.begin=s_buffer+s_segment_write_idx*pmfplayer_audio_segment_size;
+  buf.num_samples=pmfplayer_audio_segment_size;
+  ++s_segment_write_count;
+  if(++s_segment_write_idx==pmfplayer_audio_segments)
+    s_segment_write_idx=0;
   return buf;
 }
 //----
@@ -0,0 +1,98 @@
+//============================================================================
+// PMF Player v0.3
+//
+// Host platform for offline rendering and profiling: instead of a timer
+// interrupt feeding a DAC, render() pulls the samples the DAC would get.
+// Mixing goes through the portable mixer in pmf_mixer.cpp. The platform
+// state is per thread, so every thread can render with its own player.
+//============================================================================
+
+#include "pmf_player.h"
+#if !defined(__AVR__)
+#include "pmf_data.h"
+#include "pmf_mixer.h"
+//---------------------------------------------------------------------------
+
+
+//===========================================================================
+// audio buffer
+//===========================================================================
+static thread_local int16_t s_buffer[pmfplayer_audio_segment_size];  // one AVR ring segment
+static thread_local unsigned s_num_requested_samples=0;
+//---------------------------------------------------------------------------
+
+//===========================================================================
+// pmf_player
+//===========================================================================
+void pmf_player::enable_output() {}
+
+void pmf_player::disable_output() {}
+
+void pmf_player::mix_buffer(mixer_buffer &buf_, unsigned num_samples_)
+{
+  int16_t *buffer_begin=(int16_t*)buf_.begin;
+  audio_channel *channel=m_channels, *channel_end=channel+num_mix_channels();
+  do
+  {
+    // check for active channel
+    if(!channel->sample_speed)
+      continue;
+
+    // the AVR mixer works on 16-bit flash addresses, so positions are 16-bit too
+    pmf_mixer_channel chl;
+    chl.data=(const int8_t*)(m_pmf_file+pgm_read_word(channel->inst_metadata+pmfcfg_offset_inst_offset));
+    chl.pos=(uint32_t(uint16_t(channel->sample_pos>>8))<<8)+uint8_t(channel->sample_pos);
+    chl.speed=channel->sample_speed;
+    chl.length=pgm_read_word(channel->inst_metadata+pmfcfg_offset_inst_length);
+    chl.loop_length=pgm_read_word(channel->inst_metadata+pmfcfg_offset_inst_loop_length);
+    chl.volume=(uint16_t(channel->sample_volume)*channel->vol_env_value)>>8;
+    pmf_mix_channel(buffer_begin, num_samples_, chl);
+
+    // store values back to the channel data
+    channel->sample_pos=(long(uint16_t(chl.pos>>8))<<8)+uint8_t(chl.pos);
+    channel->sample_speed=chl.speed;
+  } while(++channel!=channel_end);
+
+  // advance buffer
+  ((int16_t*&)buf_.begin)+=num_samples_;
+  buf_.num_samples-=num_samples_;
+}
+//----
+
+pmf_player::mixer_buffer pmf_player::get_mixer_buffer()
+{
+  mixer_buffer buf={0, 0};
+  if(!s_num_requested_samples)
+    return buf;
+
+  // the AVR interrupt leaves the mid value behind in the played samples
+  for(unsigned i=0; i<s_num_requested_samples; ++i)
+    s_buffer[i]=0x80<<PMF_AUDIO_LEVEL;
+  buf.begin=s_buffer;
+  buf.num_samples=s_num_requested_samples;
+  s_num_requested_samples=0;
+  return buf;
+}
+//----
+
+void pmf_player::render(uint8_t *output_, unsigned num_samples_)
+{
+  while(num_samples_)
+  {
+    unsigned num_samples=num_samples_<pmfplayer_audio_segment_size?num_samples_:pmfplayer_audio_segment_size;
+    s_num_requested_samples=num_samples;
+    update();
+
+    for(unsigned i=0; i<num_samples; ++i)
+    {
+      // same conversion as the AVR interrupt, clamped to 8 bits
+      int16_t smp=s_buffer[i]>>PMF_AUDIO_LEVEL;
+      *output_++=smp<0?0:smp>255?255:uint8_t(smp);
+    }
+    num_samples_-=num_samples;
+  }
+}
+//----
+
+//===========================================================================
+#endif // !__AVR__
@@ -0,0 +1,256 @@
+#ifndef __PMF_SEEK_DATA_H
+#define __PMF_SEEK_DATA_H
+
+#include <Arduino.h>
+
+// seek indices of the songs in audio_data.h with track snapshots every 32 rows,
+// generated by tools/host/pmfseek
+
+const uint8_t PROGMEM pmfTetrisSeek[] = {
+	0x03, 0x2b, 0x20, 0x04, 0x24, 0x00, 0x60, 0x00, 0x9c, 0x00, 0xd8, 0x00, 0x14, 0x01, 0x50, 0x01,
+	0x8c, 0x01, 0xc8, 0x01, 0x04, 0x02, 0x40, 0x02, 0x7c, 0x02, 0xb8, 0x02, 0xf4, 0x02, 0x30, 0x03,
+	0x6c, 0x03, 0xa8, 0x03, 0x38, 0x01, 0x00, 0x4e, 0x42, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x61, 0x70, 0x84, 0x01, 0x00, 0x2a, 0x79, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x21, 0xed, 0x01, 0x07, 0x39, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x21, 0x2c, 0x02, 0x04, 0x4e, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32,
+	0x4e, 0x02, 0x06, 0x51, 0x45, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x07, 0x83,
+	0x02, 0x04, 0x2d, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x21, 0xc4, 0x02,
+	0x00, 0x39, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x2c, 0x02, 0x04,
+	0x4e, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32, 0xe5, 0x02, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x01, 0x00, 0x2a, 0x79,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x21, 0xed, 0x01, 0x07, 0x39, 0x79, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x21, 0xe5, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x02, 0x04, 0x2d, 0x21, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x31, 0x21, 0xc4, 0x02, 0x00, 0x39, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x01, 0xee, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x4e, 0x42, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x61, 0x70, 0x84, 0x01, 0x00, 0x2a, 0x79, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x21, 0xe5, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x2c, 0x02, 0x04, 0x4e, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32,
+	0x4e, 0x02, 0x06, 0x51, 0x45, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x07, 0x83,
+	0x02, 0x04, 0x2d, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x21, 0xe5, 0x02,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x02, 0x04,
+	0x4e, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32, 0x38, 0x01, 0x00, 0x4e,
+	0x42, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x70, 0x84, 0x01, 0x00, 0x2a, 0x79,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x21, 0x0c, 0x03, 0x06, 0x4a, 0x47, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x21, 0x2c, 0x02, 0x04, 0x4e, 0x00, 0x03, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32, 0x4e, 0x02, 0x06, 0x51, 0x45, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x07, 0x83, 0x02, 0x04, 0x2d, 0x21, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x31, 0x21, 0x29, 0x03, 0x06, 0x49, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x30, 0x21, 0x2c, 0x02, 0x04, 0x4e, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x32, 0x58, 0x03, 0x00, 0x51, 0x45, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x61, 0x70, 0xa4, 0x03, 0x00, 0x2d, 0x79, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x21, 0x0d, 0x04, 0x07, 0x3c, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x21, 0x2c, 0x02, 0x04, 0x4e, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32,
+	0x57, 0x04, 0x06, 0x54, 0x48, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x07, 0x8c,
+	0x04, 0x04, 0x30, 0x24, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x21, 0xcd, 0x04,
+	0x00, 0x3c, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x2c, 0x02, 0x04,
+	0x4e, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32, 0x0a, 0x05, 0x00, 0x54,
+	0x48, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x70, 0x56, 0x05, 0x00, 0x30, 0x79,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x21, 0xbf, 0x05, 0x07, 0x3f, 0x79, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x21, 0x2c, 0x02, 0x04, 0x4e, 0x00, 0x03, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32, 0x09, 0x06, 0x06, 0x57, 0x4b, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x07, 0x3e, 0x06, 0x04, 0x33, 0x27, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x31, 0x21, 0x7f, 0x06, 0x00, 0x3f, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x01, 0x2c, 0x02, 0x04, 0x4e, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x32, 0xd1, 0x06, 0x00, 0x48, 0x3c, 0x01, 0x00, 0x00, 0x00, 0x09, 0x09, 0x11,
+	0x01, 0x81, 0x90, 0x56, 0x05, 0x00, 0x30, 0x79, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x21, 0xbf, 0x05, 0x07, 0x3f, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x21, 0x2c, 0x02, 0x04, 0x4e, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32,
+	0x2a, 0x07, 0x00, 0x4b, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x09, 0x09, 0x11, 0x01, 0x81, 0x90, 0x3e,
+	0x06, 0x04, 0x33, 0x27, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x21, 0x7e, 0x07,
+	0x00, 0x3f, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x2c, 0x02, 0x04,
+	0x4e, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32, 0xa5, 0x07, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x56, 0x05, 0x00, 0x30, 0x79,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x21, 0xe0, 0x07, 0x03, 0x3f, 0x79, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x00, 0xcc, 0x00, 0x91, 0xa1, 0x2c, 0x02, 0x04, 0x4e, 0x00, 0x03, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32, 0xa5, 0x07, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3e, 0x06, 0x04, 0x33, 0x27, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x31, 0x21, 0x40, 0x08, 0x04, 0x3f, 0x79, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0x00, 0xcc, 0x00, 0x91, 0xa1, 0x2c, 0x02, 0x04, 0x4e, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x32
+};
+
+const uint8_t PROGMEM pmfLoveYaSeek[] = {
+	0xda, 0x26, 0x20, 0x0a, 0x1e, 0x00, 0xb4, 0x00, 0x4a, 0x01, 0xe0, 0x01, 0x76, 0x02, 0x0c, 0x03,
+	0xa2, 0x03, 0x38, 0x04, 0xce, 0x04, 0x64, 0x05, 0xfa, 0x05, 0x90, 0x06, 0x26, 0x07, 0x38, 0x02,
+	0x07, 0x48, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x46, 0x02, 0x06,
+	0x4f, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0x54, 0x02, 0x06, 0x54,
+	0x4f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0x7d, 0x02, 0x06, 0x52, 0x4f,
+	0x09, 0x00, 0x0a, 0x00, 0x05, 0x04, 0x0f, 0x0f, 0x21, 0x70, 0xb3, 0x02, 0x04, 0x48, 0x00, 0x0b,
+	0x0a, 0x10, 0x04, 0x00, 0x00, 0x04, 0x00, 0x36, 0x70, 0x05, 0x03, 0x05, 0x4c, 0x48, 0x04, 0x02,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x61, 0x46, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0x07, 0x48, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x03, 0x46, 0x02, 0x06, 0x4f, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x21, 0x03, 0x54, 0x02, 0x06, 0x54, 0x4f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
+	0x03, 0x7d, 0x02, 0x06, 0x52, 0x4f, 0x09, 0x00, 0x0a, 0x00, 0x05, 0x04, 0x0f, 0x0f, 0x21, 0x70,
+	0xb3, 0x02, 0x04, 0x48, 0x00, 0x0b, 0x0a, 0x10, 0x04, 0x00, 0x00, 0x04, 0x00, 0x36, 0x70, 0x05,
+	0x03, 0x05, 0x4c, 0x48, 0x04, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x61, 0x68, 0x03,
+	0x02, 0x79, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x0a, 0x01, 0x80, 0xa1, 0x03, 0x00,
+	0x79, 0x4c, 0x00, 0x00, 0x10, 0x00, 0x06, 0x06, 0x00, 0x0a, 0x01, 0x80, 0x46, 0x03, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x03, 0x07, 0x43, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0xd0, 0x03, 0x06, 0x4a, 0x47, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0xde, 0x03, 0x06, 0x4f, 0x4a, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0x07, 0x04, 0x06, 0x4d, 0x4a, 0x09, 0x00, 0x0a, 0x00,
+	0x05, 0x04, 0x0f, 0x0f, 0x21, 0x70, 0xb3, 0x02, 0x04, 0x48, 0x00, 0x0b, 0x0a, 0x10, 0x04, 0x00,
+	0x00, 0x04, 0x00, 0x36, 0x70, 0x67, 0x04, 0x05, 0x4a, 0x43, 0x04, 0x02, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x21, 0x61, 0xc2, 0x04, 0x01, 0x79, 0x43, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00,
+	0x0a, 0x01, 0x80, 0xfa, 0x04, 0x07, 0x79, 0x43, 0x00, 0x00, 0x10, 0x00, 0x06, 0x06, 0x00, 0x0a,
+	0x01, 0x80, 0x46, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x46, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1b, 0x05, 0x07, 0x4a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x29,
+	0x05, 0x06, 0x51, 0x4d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0x37, 0x05,
+	0x06, 0x56, 0x51, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0x60, 0x05, 0x06,
+	0x54, 0x51, 0x09, 0x00, 0x0a, 0x00, 0x05, 0x04, 0x0f, 0x0f, 0x21, 0x70, 0xb3, 0x02, 0x04, 0x48,
+	0x00, 0x0b, 0x0a, 0x10, 0x04, 0x00, 0x00, 0x04, 0x00, 0x36, 0x70, 0xc0, 0x05, 0x05, 0x4d, 0x4a,
+	0x04, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x61, 0x1b, 0x06, 0x01, 0x79, 0x4c, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x0a, 0x01, 0x80, 0x52, 0x06, 0x07, 0x79, 0x4c, 0x00, 0x00,
+	0x10, 0x00, 0x06, 0x06, 0x00, 0x0a, 0x01, 0x80, 0x46, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x06, 0x07, 0x4f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x30, 0x03, 0x81, 0x06, 0x06, 0x56, 0x53, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x21, 0x03, 0x8f, 0x06, 0x06, 0x5b, 0x56, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x21, 0x03, 0xb8, 0x06, 0x06, 0x59, 0x56, 0x09, 0x00, 0x0a, 0x00, 0x05, 0x04, 0x0f, 0x0f,
+	0x21, 0x70, 0xb3, 0x02, 0x04, 0x48, 0x00, 0x0b, 0x0a, 0x10, 0x04, 0x00, 0x00, 0x04, 0x00, 0x36,
+	0x70, 0x18, 0x07, 0x05, 0x51, 0x4a, 0x04, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x61,
+	0x74, 0x07, 0x00, 0x79, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x0a, 0x01, 0x80, 0xb2,
+	0x07, 0x06, 0x79, 0x4a, 0x00, 0x00, 0x10, 0x00, 0x06, 0x06, 0x00, 0x0a, 0x01, 0x80, 0x46, 0x03,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x02, 0x07, 0x48,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x46, 0x02, 0x06, 0x4f, 0x4c,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0x54, 0x02, 0x06, 0x54, 0x4f, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0x7d, 0x02, 0x06, 0x52, 0x4f, 0x09, 0x00,
+	0x0a, 0x00, 0x05, 0x04, 0x0f, 0x0f, 0x21, 0x70, 0xb3, 0x02, 0x04, 0x48, 0x00, 0x0b, 0x0a, 0x10,
+	0x04, 0x00, 0x00, 0x04, 0x00, 0x36, 0x70, 0x05, 0x03, 0x05, 0x4c, 0x48, 0x04, 0x02, 0x10, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x21, 0x61, 0xe0, 0x07, 0x06, 0x54, 0x53, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x06, 0x00, 0x0a, 0x80, 0x80, 0xf4, 0x07, 0x04, 0x54, 0x53, 0x00, 0x00, 0x10, 0x00, 0x06, 0x06,
+	0x00, 0x0a, 0x80, 0x80, 0x07, 0x08, 0x04, 0x79, 0x4a, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x03, 0x23, 0x08, 0x05, 0x4c, 0x79, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x30, 0xc2, 0x03, 0x07, 0x43, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x03, 0xd0, 0x03, 0x06, 0x4a, 0x47, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03,
+	0xde, 0x03, 0x06, 0x4f, 0x4a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0x07,
+	0x04, 0x06, 0x4d, 0x4a, 0x09, 0x00, 0x0a, 0x00, 0x05, 0x04, 0x0f, 0x0f, 0x21, 0x70, 0xb3, 0x02,
+	0x04, 0x48, 0x00, 0x0b, 0x0a, 0x10, 0x04, 0x00, 0x00, 0x04, 0x00, 0x36, 0x70, 0x67, 0x04, 0x05,
+	0x4a, 0x43, 0x04, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x61, 0x46, 0x03, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x08, 0x04, 0x79, 0x45, 0x08,
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x5b, 0x08, 0x05, 0x47, 0x79, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x30, 0x1b, 0x05, 0x07, 0x4a, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x29, 0x05, 0x06, 0x51, 0x4d, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0x37, 0x05, 0x06, 0x56, 0x51, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x21, 0x03, 0x60, 0x05, 0x06, 0x54, 0x51, 0x09, 0x00, 0x0a, 0x00, 0x05, 0x04,
+	0x0f, 0x0f, 0x21, 0x70, 0xb3, 0x02, 0x04, 0x48, 0x00, 0x0b, 0x0a, 0x10, 0x04, 0x00, 0x00, 0x04,
+	0x00, 0x36, 0x70, 0xc0, 0x05, 0x05, 0x4d, 0x4a, 0x04, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x21, 0x61, 0x46, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x46, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x77, 0x08, 0x04, 0x79, 0x59, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x93,
+	0x08, 0x05, 0x58, 0x79, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x30, 0x73, 0x06,
+	0x07, 0x4f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x81, 0x06, 0x06,
+	0x56, 0x53, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0x8f, 0x06, 0x06, 0x5b,
+	0x56, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0xb8, 0x06, 0x06, 0x59, 0x56,
+	0x09, 0x00, 0x0a, 0x00, 0x05, 0x04, 0x0f, 0x0f, 0x21, 0x70, 0xb3, 0x02, 0x04, 0x48, 0x00, 0x0b,
+	0x0a, 0x10, 0x04, 0x00, 0x00, 0x04, 0x00, 0x36, 0x70, 0x18, 0x07, 0x05, 0x51, 0x4a, 0x04, 0x02,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x61, 0x46, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x08, 0x04, 0x79, 0x56, 0x08, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x03, 0xcb, 0x08, 0x05, 0x54, 0x79, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x30, 0x38, 0x02, 0x07, 0x48, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x03, 0x46, 0x02, 0x06, 0x4f, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x21, 0x03, 0x54, 0x02, 0x06, 0x54, 0x4f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
+	0x03, 0x7d, 0x02, 0x06, 0x52, 0x4f, 0x09, 0x00, 0x0a, 0x00, 0x05, 0x04, 0x0f, 0x0f, 0x21, 0x70,
+	0xb3, 0x02, 0x04, 0x48, 0x00, 0x0b, 0x0a, 0x10, 0x04, 0x00, 0x00, 0x04, 0x00, 0x36, 0x70, 0x05,
+	0x03, 0x05, 0x4c, 0x48, 0x04, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x61, 0xfb, 0x08,
+	0x07, 0x79, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x0a, 0x01, 0x80, 0x3a, 0x09, 0x05,
+	0x4d, 0x4c, 0x00, 0x00, 0x10, 0x00, 0x06, 0x06, 0x00, 0x0a, 0x80, 0xe1, 0x46, 0x03, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x03, 0x07, 0x43, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0xd0, 0x03, 0x06, 0x4a, 0x47, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0xde, 0x03, 0x06, 0x4f, 0x4a, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0x07, 0x04, 0x06, 0x4d, 0x4a, 0x09, 0x00, 0x0a, 0x00,
+	0x05, 0x04, 0x0f, 0x0f, 0x21, 0x70, 0xb3, 0x02, 0x04, 0x48, 0x00, 0x0b, 0x0a, 0x10, 0x04, 0x00,
+	0x00, 0x04, 0x00, 0x36, 0x70, 0x67, 0x04, 0x05, 0x4a, 0x43, 0x04, 0x02, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x21, 0x61, 0x75, 0x09, 0x01, 0x79, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00,
+	0x0a, 0x01, 0x80, 0xb0, 0x09, 0x07, 0x79, 0x4a, 0x00, 0x00, 0x10, 0x00, 0x06, 0x06, 0x00, 0x0a,
+	0x01, 0x80, 0x46, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x46, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1b, 0x05, 0x07, 0x4a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x29,
+	0x05, 0x06, 0x51, 0x4d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0x37, 0x05,
+	0x06, 0x56, 0x51, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x03, 0x60, 0x05, 0x06,
+	0x54, 0x51, 0x09, 0x00, 0x0a, 0x00, 0x05, 0x04, 0x0f, 0x0f, 0x21, 0x70, 0xb3, 0x02, 0x04, 0x48,
+	0x00, 0x0b, 0x0a, 0x10, 0x04, 0x00, 0x00, 0x04, 0x00, 0x36, 0x70, 0xc0, 0x05, 0x05, 0x4d, 0x4a,
+	0x04, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x61, 0xef, 0x09, 0x00, 0x4c, 0x79, 0x00,
+	0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x0a, 0x91, 0x80, 0x2d, 0x0a, 0x06, 0x4c, 0x79, 0x00, 0x00,
+	0x10, 0x00, 0x06, 0x06, 0x00, 0x0a, 0x80, 0xe1, 0x46, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x06, 0x07, 0x4f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x30, 0x03, 0x81, 0x06, 0x06, 0x56, 0x53, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x21, 0x03, 0x8f, 0x06, 0x06, 0x5b, 0x56, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x21, 0x03, 0xb8, 0x06, 0x06, 0x59, 0x56, 0x09, 0x00, 0x0a, 0x00, 0x05, 0x04, 0x0f, 0x0f,
+	0x21, 0x70, 0xb3, 0x02, 0x04, 0x48, 0x00, 0x0b, 0x0a, 0x10, 0x04, 0x00, 0x00, 0x04, 0x00, 0x36,
+	0x70, 0x18, 0x07, 0x05, 0x51, 0x4a, 0x04, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x61,
+	0x6c, 0x0a, 0x00, 0x58, 0x79, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x0a, 0x11, 0x80, 0xa9,
+	0x0a, 0x06, 0x58, 0x79, 0x00, 0x00, 0x10, 0x00, 0x06, 0x06, 0x00, 0x0a, 0x80, 0xe1, 0x46, 0x03,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const uint8_t PROGMEM pmfLoveInMyDreamsSeek[] = {
+	0xe3, 0x11, 0x20, 0x04, 0x12, 0x00, 0x4e, 0x00, 0x8a, 0x00, 0xc6, 0x00, 0x02, 0x01, 0x3e, 0x01,
+	0x7a, 0x01, 0x47, 0x01, 0x00, 0x50, 0x44, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+	0x21, 0x8b, 0x01, 0x05, 0x3a, 0x3e, 0x04, 0x05, 0x10, 0x00, 0x07, 0x07, 0x47, 0x37, 0x40, 0x92,
+	0xc1, 0x01, 0x06, 0x48, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32, 0x12,
+	0x02, 0x01, 0x3e, 0x43, 0x08, 0x07, 0x10, 0x00, 0x06, 0x08, 0x00, 0x00, 0x88, 0x8b, 0x47, 0x01,
+	0x00, 0x50, 0x44, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x21, 0x8b, 0x01, 0x05,
+	0x3a, 0x3e, 0x04, 0x05, 0x10, 0x00, 0x07, 0x07, 0x47, 0x37, 0x40, 0x92, 0x8c, 0x02, 0x04, 0x4f,
+	0x4a, 0x09, 0x08, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x53, 0x0a, 0x03, 0x00, 0x48, 0x4d,
+	0x0b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x13, 0x47, 0x01, 0x00, 0x50, 0x44, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x21, 0x8b, 0x01, 0x05, 0x3a, 0x3e, 0x04, 0x05,
+	0x10, 0x00, 0x07, 0x07, 0x47, 0x37, 0x40, 0x92, 0xc1, 0x01, 0x06, 0x48, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32, 0x83, 0x03, 0x01, 0x4a, 0x46, 0x07, 0x06, 0x10, 0x00,
+	0x06, 0x08, 0x00, 0x00, 0x40, 0x88, 0xe3, 0x03, 0x00, 0x52, 0x46, 0x03, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x31, 0x21, 0x27, 0x04, 0x05, 0x3c, 0x40, 0x04, 0x05, 0x10, 0x00, 0x07, 0x07,
+	0x47, 0x37, 0x40, 0x92, 0x89, 0x04, 0x06, 0x51, 0x4c, 0x09, 0x08, 0x0a, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x43, 0x53, 0x06, 0x05, 0x02, 0x4a, 0x4f, 0x0b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x13, 0x47, 0x01, 0x00, 0x50, 0x44, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+	0x21, 0x4b, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x63, 0x05, 0x06, 0x48, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x12, 0x77,
+	0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xc4, 0x05,
+	0x04, 0x50, 0x44, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x31, 0x21, 0x4b, 0x05, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xe8, 0x05, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x4b, 0x05, 0x05, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x04, 0x44, 0x38, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x2f, 0x06, 0x07, 0x3a, 0x3e, 0x04, 0x05,
+	0x00, 0x00, 0x07, 0x07, 0x47, 0x37, 0x80, 0x92, 0x4b, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x4b, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x00
+};
+
+const uint8_t PROGMEM pmfChippySeek[] = {
+	0x35, 0x0b, 0x20, 0x04, 0x0e, 0x00, 0x4a, 0x00, 0x86, 0x00, 0xc2, 0x00, 0xfe, 0x00, 0xd6, 0x00,
+	0x06, 0x45, 0x00, 0x06, 0x05, 0x00, 0x00, 0x07, 0x00, 0x37, 0x00, 0xa2, 0x82, 0x0b, 0x01, 0x04,
+	0x45, 0x39, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x30, 0x38, 0x01, 0x06, 0x48,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x12, 0x76, 0x01, 0x04, 0x48, 0x4c,
+	0x06, 0x00, 0x10, 0x20, 0x06, 0x08, 0x1f, 0x00, 0x40, 0x44, 0xad, 0x01, 0x06, 0x43, 0x00, 0x06,
+	0x05, 0x00, 0x00, 0x07, 0x00, 0x47, 0x00, 0xa2, 0x82, 0xe0, 0x01, 0x04, 0x43, 0x37, 0x03, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x30, 0x38, 0x01, 0x06, 0x48, 0x00, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x12, 0x1e, 0x02, 0x06, 0x45, 0x43, 0x06, 0x00, 0x10, 0x20,
+	0x08, 0x06, 0x00, 0x1f, 0x88, 0xa9, 0x50, 0x02, 0x06, 0x41, 0x00, 0x06, 0x05, 0x00, 0x00, 0x07,
+	0x00, 0x47, 0x00, 0xa2, 0x82, 0x83, 0x02, 0x04, 0x41, 0x35, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x70, 0x30, 0x38, 0x01, 0x06, 0x48, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x32, 0x12, 0xb5, 0x02, 0x04, 0x4a, 0x48, 0x06, 0x00, 0x10, 0x20, 0x08, 0x00, 0x00, 0x00,
+	0x40, 0x44, 0xe7, 0x02, 0x06, 0x41, 0x00, 0x06, 0x05, 0x00, 0x00, 0x07, 0x00, 0x47, 0x00, 0xa2,
+	0x82, 0x1a, 0x03, 0x04, 0x41, 0x35, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x30,
+	0x47, 0x03, 0x06, 0x48, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x12, 0x7b,
+	0x03, 0x04, 0x4a, 0x48, 0x06, 0x00, 0x10, 0x20, 0x08, 0x00, 0x00, 0x00, 0x40, 0x44, 0xb4, 0x03,
+	0x00, 0x43, 0x00, 0x06, 0x05, 0x00, 0x00, 0x07, 0x00, 0x47, 0x04, 0xa2, 0x82, 0xc3, 0x03, 0x04,
+	0x43, 0x37, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x21, 0xd9, 0x03, 0x00, 0x48,
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3a, 0x32, 0xe8, 0x03, 0x03, 0x47, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x80, 0x80
+};
+
+#endif
@@ -0,0 +1,75 @@
+#include "quality_governor.h"
+
+QualityGovernor::QualityGovernor(uint32_t budget, qualityListener listener):
+		_budget(budget), _listener(listener), _level(Full), _started(false),
+		_iterationStart(0), _windowStart(0), _windowMax(0), _windowOverruns(0),
+		_maxIterationTime(0), _headroomWindows(0) {}
+
+void QualityGovernor::update() {
+	uint32_t now = _micros();
+
+	if (!_started) {
+		_started = true;
+		_iterationStart = _windowStart = now;
+		return;
+	}
+
+	// an iteration lasts from one update() to the next
+	uint32_t iteration = now - _iterationStart;
+	_iterationStart = now;
+
+	if (iteration > _windowMax) {
+		_windowMax = iteration;
+	}
+
+	if (iteration > _budget && _windowOverruns < 255) {
+		_windowOverruns++;
+	}
+
+	if (now - _windowStart >= QUALITY_WINDOW_US) {
+		_evaluate();
+
+		_windowStart = now;
+		_windowMax = 0;
+		_windowOverruns = 0;
+	}
+}
+
+QualityGovernor::Level QualityGovernor::getLevel() {
+	return _level;
+}
+
+uint32_t QualityGovernor::getBudget() {
+	return _budget;
+}
+
+uint32_t QualityGovernor::getMaxIterationTime() {
+	return _maxIterationTime;
+}
+
+void QualityGovernor::_evaluate() {
+	_maxIterationTime = _windowMax;
+
+	if (_windowOverruns > QUALITY_OVERRUN_LIMIT) {
+		_headroomWindows = 0;
+
+		if (_level < ReducedChannels) {
+			_setLevel((Level) (_level + 1));
+		}
+	} else if (_windowMax < _budget / 100 * QUALITY_HEADROOM_PERCENT) {
+		if (_level > Full && ++_headroomWindows >= QUALITY_RESTORE_WINDOWS) {
+			_headroomWindows = 0;
+			_setLevel((Level) (_level - 1));
+		}
+	} else {
+		_headroomWindows = 0;
+	}
+}
+
+void QualityGovernor::_setLevel(Level level) {
+	_level = level;
+
+	if (_listener != NULL) {
+		_listener(_level, _maxIterationTime);
+	}
+}
@@ -0,0 +1,57 @@
+#ifndef __QUALITY_GOVERNOR_H
+#define __QUALITY_GOVERNOR_H
+
+#include <stddef.h>
+#include <inttypes.h>
+
+// Loop iterations are evaluated in windows of this length. A window with
+// more overruns than the limit degrades the quality by one level, a single
+// long iteration (such as an EEPROM write) does not.
+#define QUALITY_WINDOW_US      500000
+#define QUALITY_OVERRUN_LIMIT  2
+
+// A level is restored after this many consecutive windows whose longest
+// iteration stayed below the given share of the budget.
+#define QUALITY_RESTORE_WINDOWS   4
+#define QUALITY_HEADROOM_PERCENT 60
+
+class QualityGovernor {
+
+public:
+
+	// every level keeps the degradations of the levels below it
+	enum Level {
+		Full,
+		ReducedFps,
+		NoGhostPulse,
+		ReducedChannels
+	};
+
+	typedef void (*qualityListener) (Level level, uint32_t maxIterationTime);
+
+	QualityGovernor(uint32_t budget, qualityListener listener);
+
+	void update();
+	Level getLevel();
+	uint32_t getBudget();
+	uint32_t getMaxIterationTime();
+
+private:
+
+	uint32_t _budget; // in microseconds
+	qualityListener _listener;
+	Level _level;
+	bool _started;
+	uint32_t _iterationStart;
+	uint32_t _windowStart;
+	uint32_t _windowMax;
+	uint8_t _windowOverruns;
+	uint32_t _maxIterationTime; // longest iteration of the last window
+	uint8_t _headroomWindows;
+
+	void _evaluate();
+	void _setLevel(Level level);
+	unsigned long _micros();
+};
+
+#endif
@@ -0,0 +1,458 @@
+#ifndef __SPRITE_DELTA_DATA_H
+#define __SPRITE_DELTA_DATA_H
+
+// generated by tools/sprite_delta.py, do not edit
+// always in PROGMEM, Catris reads them with pgm_read_byte
+
+#include "graphics.h"
+#include "sprite_data.h"
+
+const uint8_t PROGMEM catrisHappy1RightToCatrisHappy1LeftDelta[] = {
+
+		/* color:  */ 0,
+		/* pixels: */ 6,
+		/* data:   */ 0b00010101, 0b00100100, 0b00110101, 0b01010101, 0b01100100, 0b01110101,
+
+		/* color:  */ 1,
+		/* pixels: */ 2,
+		/* data:   */ 0b00010110, 0b01110110,
+
+		/* color:  */ 2,
+		/* pixels: */ 2,
+		/* data:   */ 0b00100101, 0b01100101,
+
+		/* color:  */ 3,
+		/* pixels: */ 2,
+		/* data:   */ 0b01000111, 0b01011000,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 8,
+		/* data:   */ 0b00100110, 0b00110100, 0b01000101, 0b01001000, 0b01010111, 0b01110100, 0b10000101, 0b10000110,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisHappy1LeftToCatrisHappy2LeftDelta[] = {
+
+		/* color:  */ 3,
+		/* pixels: */ 1,
+		/* data:   */ 0b01001000,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 1,
+		/* data:   */ 0b01011000,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisHappy2LeftToCatrisHappy3LeftDelta[] = {
+
+		/* color:  */ 3,
+		/* pixels: */ 1,
+		/* data:   */ 0b01011000,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 1,
+		/* data:   */ 0b01000111,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisHappy3LeftToCatrisHappy1LeftDelta[] = {
+
+		/* color:  */ 3,
+		/* pixels: */ 1,
+		/* data:   */ 0b01000111,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 1,
+		/* data:   */ 0b01001000,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisHappy3LeftToCatrisHappy3RightDelta[] = {
+
+		/* color:  */ 0,
+		/* pixels: */ 6,
+		/* data:   */ 0b00100101, 0b00110100, 0b01000101, 0b01100101, 0b01110100, 0b10000101,
+
+		/* color:  */ 1,
+		/* pixels: */ 2,
+		/* data:   */ 0b00100110, 0b10000110,
+
+		/* color:  */ 2,
+		/* pixels: */ 2,
+		/* data:   */ 0b00110101, 0b01110101,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 6,
+		/* data:   */ 0b00010101, 0b00010110, 0b00100100, 0b01010101, 0b01100100, 0b01110110,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisHappy3RightToCatrisHappy2RightDelta[] = {
+
+		/* color:  */ 3,
+		/* pixels: */ 1,
+		/* data:   */ 0b01010111,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 1,
+		/* data:   */ 0b01001000,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisHappy2RightToCatrisHappy1RightDelta[] = {
+
+		/* color:  */ 3,
+		/* pixels: */ 1,
+		/* data:   */ 0b01001000,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 1,
+		/* data:   */ 0b01011000,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisHappy1RightToCatrisHappy3RightDelta[] = {
+
+		/* color:  */ 3,
+		/* pixels: */ 1,
+		/* data:   */ 0b01011000,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 1,
+		/* data:   */ 0b01010111,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisShocked2ToCatrisShocked1Delta[] = {
+
+		/* color:  */ 2,
+		/* pixels: */ 4,
+		/* data:   */ 0b00100110, 0b00110110, 0b01100110, 0b01110110,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisShocked1ToCatrisShocked2Delta[] = {
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 4,
+		/* data:   */ 0b00100110, 0b00110110, 0b01100110, 0b01110110,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisShocked2ToCatrisShocked3Delta[] = {
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 4,
+		/* data:   */ 0b00100101, 0b00110101, 0b01100101, 0b01110101,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisShocked3ToCatrisShocked2Delta[] = {
+
+		/* color:  */ 2,
+		/* pixels: */ 4,
+		/* data:   */ 0b00100101, 0b00110101, 0b01100101, 0b01110101,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisShocked1ToCatrisShocked3Delta[] = {
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 8,
+		/* data:   */ 0b00100101, 0b00100110, 0b00110101, 0b00110110, 0b01100101, 0b01100110, 0b01110101, 0b01110110,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisWorried3ToCatrisWorried1Delta[] = {
+
+		/* color:  */ 3,
+		/* pixels: */ 1,
+		/* data:   */ 0b01100111,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisWorried1ToCatrisWorried2Delta[] = {
+
+		/* color:  */ 3,
+		/* pixels: */ 1,
+		/* data:   */ 0b00110111,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 1,
+		/* data:   */ 0b01100111,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisWorried2ToCatrisWorried3Delta[] = {
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 1,
+		/* data:   */ 0b00110111,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisWorried3ToCatrisWorried4Delta[] = {
+
+		/* color:  */ 0,
+		/* pixels: */ 2,
+		/* data:   */ 0b01001001, 0b01011001,
+
+		/* color:  */ 3,
+		/* pixels: */ 2,
+		/* data:   */ 0b01001000, 0b01011000,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisWorried4ToCatrisWorried3Delta[] = {
+
+		/* color:  */ 0,
+		/* pixels: */ 2,
+		/* data:   */ 0b01001000, 0b01011000,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 2,
+		/* data:   */ 0b01001001, 0b01011001,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisWorried3ToCatrisWorried2Delta[] = {
+
+		/* color:  */ 3,
+		/* pixels: */ 1,
+		/* data:   */ 0b00110111,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisWorried2ToCatrisWorried1Delta[] = {
+
+		/* color:  */ 3,
+		/* pixels: */ 1,
+		/* data:   */ 0b01100111,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 1,
+		/* data:   */ 0b00110111,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisWorried1ToCatrisWorried4Delta[] = {
+
+		/* color:  */ 0,
+		/* pixels: */ 2,
+		/* data:   */ 0b01001001, 0b01011001,
+
+		/* color:  */ 3,
+		/* pixels: */ 2,
+		/* data:   */ 0b01001000, 0b01011000,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 1,
+		/* data:   */ 0b01100111,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisWorried4ToCatrisWorried1Delta[] = {
+
+		/* color:  */ 0,
+		/* pixels: */ 2,
+		/* data:   */ 0b01001000, 0b01011000,
+
+		/* color:  */ 3,
+		/* pixels: */ 1,
+		/* data:   */ 0b01100111,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 2,
+		/* data:   */ 0b01001001, 0b01011001,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisInLove1ToCatrisInLove1Delta[] = {
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisInLove1ToCatrisInLove2Delta[] = {
+
+		/* color:  */ 4,
+		/* pixels: */ 2,
+		/* data:   */ 0b00100101, 0b00110101,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 5,
+		/* data:   */ 0b01000100, 0b01010011, 0b01100100, 0b01110011, 0b10000100,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisInLove2ToCatrisInLove3Delta[] = {
+
+		/* color:  */ 4,
+		/* pixels: */ 3,
+		/* data:   */ 0b00100100, 0b01000100, 0b01000101,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 3,
+		/* data:   */ 0b01010100, 0b01010101, 0b01110100,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisInLove3ToCatrisInLove4Delta[] = {
+
+		/* color:  */ 4,
+		/* pixels: */ 5,
+		/* data:   */ 0b00010100, 0b00100011, 0b00110100, 0b01000011, 0b01010100,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 2,
+		/* data:   */ 0b01100101, 0b01110101,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisInLove4ToCatrisInLove3Delta[] = {
+
+		/* color:  */ 4,
+		/* pixels: */ 2,
+		/* data:   */ 0b01100101, 0b01110101,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 5,
+		/* data:   */ 0b00010100, 0b00100011, 0b00110100, 0b01000011, 0b01010100,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisInLove3ToCatrisInLove2Delta[] = {
+
+		/* color:  */ 4,
+		/* pixels: */ 3,
+		/* data:   */ 0b01010100, 0b01010101, 0b01110100,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 3,
+		/* data:   */ 0b00100100, 0b01000100, 0b01000101,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM catrisInLove2ToCatrisInLove1Delta[] = {
+
+		/* color:  */ 4,
+		/* pixels: */ 5,
+		/* data:   */ 0b01000100, 0b01010011, 0b01100100, 0b01110011, 0b10000100,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 2,
+		/* data:   */ 0b00100101, 0b00110101,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM lowBattery3ToLowBattery1Delta[] = {
+
+		/* color:  */ 5,
+		/* pixels: */ 12,
+		/* data:   */ 0b00110111, 0b00111000, 0b00111001, 0b01000111, 0b01001000, 0b01001001, 0b01010111, 0b01011000, 0b01011001, 0b01100111, 0b01101000, 0b01101001,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM lowBattery1ToLowBattery2Delta[] = {
+
+		/* color:  */ 6,
+		/* pixels: */ 8,
+		/* data:   */ 0b00111000, 0b00111001, 0b01001000, 0b01001001, 0b01011000, 0b01011001, 0b01101000, 0b01101001,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 4,
+		/* data:   */ 0b00110111, 0b01000111, 0b01010111, 0b01100111,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM lowBattery2ToLowBattery3Delta[] = {
+
+		/* color:  */ 4,
+		/* pixels: */ 4,
+		/* data:   */ 0b00111001, 0b01001001, 0b01011001, 0b01101001,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 4,
+		/* data:   */ 0b00111000, 0b01001000, 0b01011000, 0b01101000,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM highScore2ToHighScore1Delta[] = {
+
+		/* color:  */ 5,
+		/* pixels: */ 2,
+		/* data:   */ 0b00100011, 0b01000001,
+
+		/* color:  */ 7,
+		/* pixels: */ 1,
+		/* data:   */ 0b00110010,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM highScore1ToHighScore2Delta[] = {
+
+		/* color:  */ 0,
+		/* pixels: */ 3,
+		/* data:   */ 0b00100011, 0b00110010, 0b01000001,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM highScore2ToHighScore3Delta[] = {
+
+		/* color:  */ 0,
+		/* pixels: */ 4,
+		/* data:   */ 0b00010100, 0b00100001, 0b01000011, 0b01010000,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+const uint8_t PROGMEM highScore3ToHighScore2Delta[] = {
+
+		/* color:  */ 5,
+		/* pixels: */ 1,
+		/* data:   */ 0b01000011,
+
+		/* color:  */ 8,
+		/* pixels: */ 1,
+		/* data:   */ 0b01010000,
+
+		/* color:  */ SPRITE_DELTA_CLEAR,
+		/* pixels: */ 2,
+		/* data:   */ 0b00010100, 0b00100001,
+
+		/* end:    */ 0b00000000, 0b00000000
+};
+
+#endif
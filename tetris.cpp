@@ -64,7 +64,7 @@ void Tetromino::draw(canvas canvas, uint8_t* color) {
 }
 
 Pile::Pile(uint8_t _width, uint8_t _height):
-		_width(_width), _height(_height) {
+		_width(_width), _height(_height), _clearedRowCount(0) {
 
 	_data = (uint8_t*) malloc(sizeof(uint8_t) * _memSize());
 
@@ -110,6 +110,11 @@ uint8_t Pile::clearCompleteRows() {
 		}
 
 		if (full) {
+			// rows above the cleared ones have already moved down
+			if (rowsCompleted < PILE_MAX_CLEARED_ROWS) {
+				_clearedRows[rowsCompleted] = y - rowsCompleted;
+			}
+
 			rowsCompleted++;
 
 			uint8_t _y = y;
@@ -142,9 +147,19 @@ uint8_t Pile::clearCompleteRows() {
 		}
 	}
 
+	_clearedRowCount = rowsCompleted < PILE_MAX_CLEARED_ROWS ? rowsCompleted : PILE_MAX_CLEARED_ROWS;
+
 	return rowsCompleted;
 }
 
+uint8_t Pile::getClearedRowCount() {
+	return _clearedRowCount;
+}
+
+int8_t Pile::getClearedRow(uint8_t idx) {
+	return _clearedRows[idx];
+}
+
 void Pile::draw(canvas canvas) {
 	for (uint8_t y = 0; y < _height; ++y) {
 		for (uint8_t x = 0; x < _width; ++x) {
@@ -237,7 +252,7 @@ void Bag::shuffle() {
 Tetris::Tetris(uint8_t _width,  uint8_t _height, tetrisListener _listener):
 		_width(_width), _height(_height), _listener(_listener),
 		_scores(0), _rowsCompleted(0), _level(1), _gameOver(true), _paused(false),
-		_clearBackground(true), _ghostEnabled(true) {
+		_clearBackground(true), _ghostEnabled(true), _ghostPulseEnabled(true) {
 
 	_tetromino = new Tetromino();
 	_pile = new Pile(_width, _height);
@@ -291,6 +306,14 @@ uint8_t Tetris::getLevel() {
 	return _level;
 }
 
+uint8_t Tetris::getClearedRowCount() {
+	return _pile->getClearedRowCount();
+}
+
+int8_t Tetris::getClearedRow(uint8_t idx) {
+	return _pile->getClearedRow(idx);
+}
+
 Tetromino::Type Tetris::preview() {
 	return _bag->peek();
 }
@@ -365,6 +388,10 @@ void Tetris::setGhostEnabled(bool ghostEnabled) {
 	_ghostEnabled = ghostEnabled;
 }
 
+void Tetris::setGhostPulseEnabled(bool ghostPulseEnabled) {
+	_ghostPulseEnabled = ghostPulseEnabled;
+}
+
 void Tetris::update() {
 	if (_gameOver || _paused) {
 		return;
@@ -419,30 +446,43 @@ void Tetris::draw(canvas canvas) {
 		clearCanvas(canvas, 0, 0, _width, _height);
 	}
 
-	if (!_gameOver) {
-		if (_ghostEnabled) {
-			uint8_t x = _tetromino->x;
-			uint8_t y = _tetromino->y;
+	drawGhost(canvas);
+	drawPiece(canvas);
+	drawPile(canvas);
+}
 
-			while (_move(0, 1));
+void Tetris::drawPile(canvas canvas) {
+	_pile->draw(canvas);
+}
 
-			uint8_t ghostColor[3];
-			uint8_t* minoColor = Tetromino::colorOf(_tetromino->type);
+void Tetris::drawGhost(canvas canvas) {
+	if (_gameOver || !_ghostEnabled) {
+		return;
+	}
 
-			pulsateColor(255, 255, 255,
-					minoColor[0], minoColor[1], minoColor[2],
-					_ghostTimer->progress(true), ghostColor);
+	uint8_t x = _tetromino->x;
+	uint8_t y = _tetromino->y;
 
-			_tetromino->draw(canvas, ghostColor);
+	while (_move(0, 1));
 
-			_tetromino->x = x;
-			_tetromino->y = y;
-		}
+	uint8_t ghostColor[3];
+	uint8_t* minoColor = Tetromino::colorOf(_tetromino->type);
+
+	// a still ghost stays halfway between white and the piece color
+	pulsateColor8(255, 255, 255,
+			minoColor[0], minoColor[1], minoColor[2],
+			_ghostPulseEnabled ? _ghostTimer->progress8() : 64, ghostColor);
 
+	_tetromino->draw(canvas, ghostColor);
+
+	_tetromino->x = x;
+	_tetromino->y = y;
+}
+
+void Tetris::drawPiece(canvas canvas) {
+	if (!_gameOver) {
 		_tetromino->draw(canvas, NULL);
 	}
-
-	_pile->draw(canvas);
 }
 
 bool Tetris::_checkTetromino() {
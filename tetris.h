@@ -8,6 +8,7 @@
 
 #define TETROMINO_COUNT  7
 #define PILE_HIDDEN_ROWS 3
+#define PILE_MAX_CLEARED_ROWS 4
 
 #define uint4_pack(a, b) (a << 4 | (b & 0b1111))
 #define uint4_left(i) (i >> 4)
@@ -195,6 +196,8 @@ public:
 	bool isOccupied(uint8_t x, int8_t y);
 	void merge(Tetromino* tetromino);
 	uint8_t clearCompleteRows();
+	uint8_t getClearedRowCount();
+	int8_t getClearedRow(uint8_t idx);
 	void draw(canvas canvas);
 	void truncate();
 
@@ -203,6 +206,8 @@ private:
 	uint8_t _width;
 	uint8_t _height;
 	uint8_t* _data;
+	uint8_t _clearedRowCount;
+	int8_t _clearedRows[PILE_MAX_CLEARED_ROWS]; // rows removed by the last clear, before shifting
 
 	uint8_t _cellCount();
 	uint8_t _memSize();
@@ -242,6 +247,8 @@ public:
 	uint32_t getScores();
 	uint16_t getRowsCompleted();
 	uint8_t getLevel();
+	uint8_t getClearedRowCount();
+	int8_t getClearedRow(uint8_t idx);
 	Tetromino::Type preview();
 	bool moveLeft();
 	bool moveRight();
@@ -250,8 +257,12 @@ public:
 	bool rotateCounterClockWise();
 	void setClearBackground(bool clearBackground);
 	void setGhostEnabled(bool ghostEnabled);
+	void setGhostPulseEnabled(bool ghostPulseEnabled);
 	void update();
 	void draw(canvas canvas);
+	void drawPile(canvas canvas);
+	void drawGhost(canvas canvas);
+	void drawPiece(canvas canvas);
 
 private:
 
@@ -268,6 +279,7 @@ private:
 	bool _paused;
 	bool _clearBackground;
 	bool _ghostEnabled;
+	bool _ghostPulseEnabled;
 
 	Timer* _updateTimer;
 	Timer* _ghostTimer;
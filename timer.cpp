@@ -1,7 +1,7 @@
 #include "timer.h"
 
 Timer::Timer(unsigned long interval):
-		_origin(_millis()), _interval(interval), _enabled(true) {}
+		_enabled(true), _origin(_millis()), _interval(interval) {}
 
 unsigned long Timer::getInterval() {
 	return _interval;
@@ -26,6 +26,16 @@ float Timer::progress(bool constrain) {
 	return constrain ? progress - (long) progress : progress;
 }
 
+uint8_t Timer::progress8() {
+	if (_interval == 0) {
+		return 0;
+	}
+
+	unsigned long elapsed = (_millis() - _origin) % _interval;
+
+	return (elapsed << 8) / _interval;
+}
+
 unsigned long Timer::elapsed() {
 	return _millis() - _origin;
 }
@@ -1,6 +1,8 @@
 #ifndef __TIMER_H
 #define __TIMER_H
 
+#include <inttypes.h>
+
 class Timer {
 
 public:
@@ -12,6 +14,7 @@ public:
 	void setOriginToNow();
 	void reset(unsigned long interval);
 	float progress(bool constrain);
+	uint8_t progress8();
 	unsigned long elapsed();
 	void setEnabled(bool enabled);
 	bool fire();
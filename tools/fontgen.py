@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+#
+# Generates a glyph atlas font (see FONT_ATLAS_MAGIC in graphics.h) from a
+# fixed-width font array and/or a glyph source file.
+#
+# Glyph source files list one glyph per block, the rows are drawn with '#'
+# for set and '.' for clear pixels, all rows of a glyph have the same width:
+#
+#   height 5
+#   glyph 0xe9
+#   .#.
+#   ##.
+#   ...
+#
+# Code points which do not form a single contiguous range are looked up
+# through a 256 byte map, which can also be forced with --sparse.
+#
+# usage: tools/fontgen.py NAME [--legacy FILE:ARRAY] [--glyphs FILE]
+#                              [--sparse] > font_atlas_data.h
+#
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+
+
+MAGIC = 0
+SPARSE = 0b1
+MISSING = 0xff
+MAP_SIZE = 256
+
+
+def strip_comments(text):
+    return re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+
+
+def parse_number(token):
+    if token.startswith('0b'):
+        return int(token[2:], 2)
+    return int(token, 0)
+
+
+def load_legacy(path, array):
+    """Decodes a fixed-width font: header (height | bytes per char), then
+    the glyphs of ASCII 32..126 with the width in the first nibble."""
+    text = strip_comments(open(path).read())
+    match = re.search(r'\b%s\[\] = \{(.*?)\};' % re.escape(array), text, re.S)
+
+    if match is None:
+        sys.exit('array %s not found in %s' % (array, path))
+
+    # entries may be constant expressions such as the header's (5 << 4) | 3
+    body = re.sub(r'//.*', '', match.group(1))
+    data = [eval(e.strip(), {}) for e in body.split(',') if e.strip()]
+    height = data[0] >> 4
+    size = data[0] & 0b1111
+    glyphs = {}
+
+    for i, c in enumerate(range(32, 127)):
+        record = data[1 + i * size:1 + (i + 1) * size]
+        width = record[0] >> 4
+        bits = ''.join('{:08b}'.format(b) for b in record)[4:]
+        glyphs[c] = [bits[y * width:(y + 1) * width] for y in range(height)]
+
+    return height, glyphs
+
+
+def load_glyphs(path):
+    height = None
+    glyphs = {}
+    code = None
+
+    for line in open(path):
+        line = line.split('//')[0].strip()
+
+        if not line:
+            continue
+
+        words = line.split()
+
+        if words[0] == 'height':
+            height = int(words[1])
+        elif words[0] == 'glyph':
+            code = parse_number(words[1]) if len(words[1]) > 1 else ord(words[1])
+            glyphs[code] = []
+        else:
+            glyphs[code].append(line.replace('#', '1').replace('.', '0'))
+
+    for code, rows in glyphs.items():
+        if len(rows) != height or len(set(map(len, rows))) > 1:
+            sys.exit('glyph 0x%02x: expected %d rows of the same width' % (code, height))
+
+    return height, glyphs
+
+
+def build(height, glyphs, sparse):
+    codes = sorted(glyphs)
+
+    if len(codes) > MISSING:
+        sys.exit('too many glyphs')
+
+    first = codes[0]
+    sparse = sparse or codes != list(range(first, first + len(codes)))
+    data = [MAGIC, height, 0 if sparse else first, len(codes), SPARSE if sparse else 0]
+
+    if sparse:
+        index = dict((code, i) for i, code in enumerate(codes))
+        data += [index.get(c, MISSING) for c in range(MAP_SIZE)]
+
+    bits = ''
+    offsets = []
+
+    for code in codes:
+        offsets.append(len(bits))
+        bits += ''.join(glyphs[code])
+
+    if len(bits) > 0xffff:
+        sys.exit('bitmap too large')
+
+    data += [len(glyphs[code][0]) for code in codes]
+
+    for offset in offsets:
+        data += [offset & 0xff, offset >> 8]
+
+    bits += '0' * (-len(bits) % 8)
+    data += [int(bits[i:i + 8], 2) for i in range(0, len(bits), 8)]
+
+    return data, sparse
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('name')
+    parser.add_argument('--legacy', help='FILE:ARRAY of a fixed-width font to import')
+    parser.add_argument('--glyphs', help='glyph source file')
+    parser.add_argument('--sparse', action='store_true', help='always emit the code point map')
+    args = parser.parse_args()
+
+    height = None
+    glyphs = {}
+
+    if args.legacy:
+        path, array = args.legacy.rsplit(':', 1)
+        height, glyphs = load_legacy(path, array)
+
+    if args.glyphs:
+        h, extra = load_glyphs(args.glyphs)
+
+        if height is not None and h != height:
+            sys.exit('glyph height %d does not match %d' % (h, height))
+
+        height = h
+        glyphs.update(extra)
+
+    if not glyphs:
+        sys.exit('no glyphs')
+
+    data, sparse = build(height, glyphs, args.sparse)
+    guard = '__%s_H' % re.sub(r'(?<!^)(?=[A-Z])', '_', args.name).upper()
+
+    out = sys.stdout
+    out.write('#ifndef %s\n#define %s\n\n' % (guard, guard))
+    out.write('// generated by tools/fontgen.py, do not edit\n\n')
+    out.write('#include "font_data.h"\n\n')
+    out.write('const uint8_t FONT_STORAGE %s[] = {\n\n' % args.name)
+    out.write('\t\t// header: magic, height, first code point, glyph count, flags\n')
+    out.write('\t\t%s,\n' % ', '.join(str(b) for b in data[:5]))
+
+    rest = data[5:]
+
+    if sparse:
+        out.write('\n\t\t// code point map\n')
+        for i in range(0, MAP_SIZE, 16):
+            out.write('\t\t%s,\n' % ', '.join('%3d' % b for b in rest[i:i + 16]))
+        rest = rest[MAP_SIZE:]
+
+    count = data[3]
+    sections = [('glyph widths', count), ('glyph bit offsets', count * 2), ('bitmap', len(rest))]
+
+    for title, size in sections:
+        out.write('\n\t\t// %s\n' % title)
+        chunk, rest = rest[:size], rest[size:]
+        for i in range(0, len(chunk), 16):
+            out.write('\t\t%s,\n' % ', '.join('0x%02x' % b for b in chunk[i:i + 16]))
+
+    out.write('};\n\n#endif\n')
+
+
+if __name__ == '__main__':
+    main()
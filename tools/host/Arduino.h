@@ -0,0 +1,28 @@
+#ifndef __HOST_ARDUINO_H
+#define __HOST_ARDUINO_H
+
+// Minimal subset of the Arduino core needed to build the graphics and game
+// code on the host.
+
+#include <stdlib.h>
+#include <inttypes.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <type_traits>
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*) (addr))
+// little endian and unaligned like on the AVR
+#define pgm_read_word(addr) ((uint16_t) (((const uint8_t*) (addr))[0] | ((const uint8_t*) (addr))[1] << 8))
+
+typedef uint8_t byte;
+
+// function instead of the Arduino macro, which would break the standard headers
+template<typename A, typename B>
+inline typename std::common_type<A, B>::type min(A a, B b) {
+	return a < b ? a : b;
+}
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef __HOST_FASTLED_H
+#define __HOST_FASTLED_H
+
+// Minimal subset of FastLED needed to build the frame buffer on the host.
+
+#include "Arduino.h"
+
+struct CRGB {
+	uint8_t r;
+	uint8_t g;
+	uint8_t b;
+
+	CRGB& setRGB(uint8_t nr, uint8_t ng, uint8_t nb) {
+		r = nr;
+		g = ng;
+		b = nb;
+
+		return *this;
+	}
+};
+
+inline uint8_t scale8(uint8_t i, uint8_t scale) {
+	return ((uint16_t) i * (1 + scale)) >> 8;
+}
+
+#endif
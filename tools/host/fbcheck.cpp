@@ -0,0 +1,207 @@
+// Checks the framebuffer kernels against the scalar math they replace, on
+// random buffers with sizes that leave every tail length after the SSE2 and
+// AVX2 lanes. Build with -mavx2 to check the AVX2 path. Also checks that the
+// power limiter picks the highest brightness within the budget and that the
+// display receives the frames at that brightness.
+//
+// usage: fbcheck [cases]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "framebuffer_ops.h"
+#include "framebuffer.h"
+
+#define MAX_PIXELS 200
+
+#define POWER_WIDTH 10
+#define POWER_HEIGHT 20
+
+#if defined(__AVX2__)
+#define KERNEL_PATH "avx2"
+#elif defined(__SSE2__)
+#define KERNEL_PATH "sse2"
+#else
+#define KERNEL_PATH "scalar"
+#endif
+
+static void randomize(uint8_t* data, uint16_t size) {
+	// mostly random bytes, with runs of equal and extreme values mixed in
+	for (uint16_t i = 0; i < size; ++i) {
+		switch (rand() % 8) {
+		case 0:
+			data[i] = 0;
+			break;
+		case 1:
+			data[i] = 255;
+			break;
+		case 2:
+			data[i] = i > 0 ? data[i - 1] : 0;
+			break;
+		default:
+			data[i] = rand();
+		}
+	}
+}
+
+static unsigned checkFill(unsigned cases) {
+	std::vector<uint8_t> buffer(MAX_PIXELS * 3 + 1);
+	unsigned mismatches = 0;
+
+	for (unsigned c = 0; c < cases; ++c) {
+		uint16_t pixels = rand() % (MAX_PIXELS + 1);
+		uint8_t r = rand(), g = rand() % 4 == 0 ? r : rand(), b = rand() % 4 == 0 ? r : rand();
+
+		// the byte behind the last pixel must survive
+		randomize(&buffer[0], buffer.size());
+		uint8_t guard = buffer[pixels * 3];
+
+		fbFill(&buffer[0], pixels, r, g, b);
+
+		bool match = buffer[pixels * 3] == guard;
+
+		for (uint16_t i = 0; i < pixels; ++i) {
+			match = match && buffer[i * 3] == r && buffer[i * 3 + 1] == g && buffer[i * 3 + 2] == b;
+		}
+
+		if (!match) {
+			fprintf(stderr, "fill: %u pixels, color %u %u %u\n", pixels, r, g, b);
+			mismatches++;
+		}
+	}
+
+	return mismatches;
+}
+
+static unsigned checkBlend(unsigned cases) {
+	uint16_t maxSize = MAX_PIXELS * 3;
+	std::vector<uint8_t> a(maxSize), b(maxSize), dst(maxSize + 1), expected(maxSize);
+	unsigned mismatches = 0;
+
+	for (unsigned c = 0; c < cases; ++c) {
+		uint16_t size = rand() % (maxSize + 1);
+		uint8_t fraction = rand() % 4 == 0 ? (rand() % 2 == 0 ? 0 : 255) : rand();
+		bool inPlace = rand() % 2 == 0;
+
+		randomize(&a[0], maxSize);
+		randomize(&b[0], maxSize);
+		randomize(&dst[0], maxSize + 1);
+		uint8_t guard = dst[size];
+
+		for (uint16_t i = 0; i < size; ++i) {
+			expected[i] = lerpQ8(a[i], b[i], fraction);
+		}
+
+		// the transitions blend the output into itself
+		if (inPlace) {
+			memcpy(&dst[0], &a[0], size);
+			fbBlend(&dst[0], &dst[0], &b[0], size, fraction);
+		} else {
+			fbBlend(&dst[0], &a[0], &b[0], size, fraction);
+		}
+
+		if (dst[size] != guard || memcmp(&dst[0], &expected[0], size)) {
+			fprintf(stderr, "blend: %u bytes, fraction %u%s\n", size, fraction, inPlace ? ", in place" : "");
+			mismatches++;
+		}
+	}
+
+	return mismatches;
+}
+
+// sums up the channels of the last frame as sent to the LEDs
+class MeterDisplay: public Display {
+
+public:
+
+	uint32_t channelSum;
+
+	void startFrame() {
+		channelSum = 0;
+	}
+
+	void writePixel(uint8_t r, uint8_t g, uint8_t b) {
+		channelSum += r + g + b;
+	}
+
+	void endFrame() {}
+};
+
+static unsigned checkPower(unsigned cases) {
+	MeterDisplay display;
+	FrameBuffer frameBuffer(POWER_WIDTH, POWER_HEIGHT);
+	uint16_t count = POWER_WIDTH * POWER_HEIGHT;
+	uint32_t idle = (uint32_t) count * FRAMEBUFFER_LED_IDLE_UA / 1000;
+	unsigned mismatches = 0;
+
+	frameBuffer.begin(&display);
+
+	for (unsigned c = 0; c < cases; ++c) {
+		uint8_t brightness = rand();
+		uint16_t budget = rand() % 4 == 0 ? 0 : rand() % 4000;
+		uint8_t level = rand();
+
+		// a random share of the pixels lit up to a random level
+		for (int8_t y = 0; y < POWER_HEIGHT; ++y) {
+			for (int8_t x = 0; x < POWER_WIDTH; ++x) {
+				bool lit = rand() % 256 < level;
+				frameBuffer.set(x, y, lit ? rand() : 0, lit ? rand() : 0, lit ? rand() : 0);
+			}
+		}
+
+		frameBuffer.setBrightness(brightness);
+		frameBuffer.setPowerBudget(budget);
+		frameBuffer.present();
+
+		CRGB* leds = frameBuffer.getLeds();
+		uint32_t channelSum = 0, sent = 0;
+		uint8_t limited = frameBuffer.getLimitedBrightness();
+
+		for (uint16_t i = 0; i < count; ++i) {
+			channelSum += leds[i].r + leds[i].g + leds[i].b;
+			sent += scale8(leds[i].r, limited) + scale8(leds[i].g, limited) + scale8(leds[i].b, limited);
+		}
+
+		// the current model in 1/65025 mA units, as in FrameBuffer::_limitPower()
+		uint64_t full = (uint64_t) channelSum * FRAMEBUFFER_CHANNEL_MA;
+		uint64_t available = budget > idle ? (uint64_t) (budget - idle) * 65025 : 0;
+		bool match = limited <= brightness && display.channelSum == sent
+				&& frameBuffer.getEstimatedCurrent() == idle + full * limited / 65025;
+
+		if (budget > 0 && idle * 65025 + full * brightness > (uint64_t) budget * 65025) {
+			// over budget: the highest brightness which still fits
+			match = match && full * limited <= available && (limited == brightness || full * (limited + 1) > available);
+		} else {
+			match = match && limited == brightness;
+		}
+
+		if (!match) {
+			fprintf(stderr, "power: budget %u mA, brightness %u, channel sum %u, limited to %u\n",
+					budget, brightness, channelSum, limited);
+			mismatches++;
+		}
+	}
+
+	return mismatches;
+}
+
+int main(int argc, char** argv) {
+	unsigned cases = 10000;
+
+	if (argc > 2 || (argc == 2 && (cases = atoi(argv[1])) == 0)) {
+		fprintf(stderr, "usage: fbcheck [cases]\n");
+		return 1;
+	}
+
+	srand(1);
+
+	unsigned fill = checkFill(cases);
+	unsigned blend = checkBlend(cases);
+	unsigned power = checkPower(cases);
+
+	printf("%s: %u cases, fill %u mismatches, blend %u mismatches, power %u mismatches\n",
+			KERNEL_PATH, cases, fill, blend, power);
+
+	return fill > 0 || blend > 0 || power > 0;
+}
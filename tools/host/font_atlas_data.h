@@ -0,0 +1,72 @@
+#ifndef __FONT4X5_ATLAS_H
+#define __FONT4X5_ATLAS_H
+
+// generated by tools/fontgen.py, do not edit
+
+#include "font_data.h"
+
+const uint8_t FONT_STORAGE font4x5Atlas[] = {
+
+		// header: magic, height, first code point, glyph count, flags
+		0, 5, 0, 102, 1,
+
+		// code point map
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		  0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+		 16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,
+		 32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,
+		 48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,
+		 64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,
+		 80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255,  95, 255, 255, 255, 255, 255, 255, 255,  96, 255, 255, 255,  97, 255, 255,
+		255, 255, 255,  98, 255, 255,  99, 255, 255, 255, 100, 255, 101, 255, 255, 255,
+
+		// glyph widths
+		0x02, 0x01, 0x03, 0x04, 0x04, 0x04, 0x04, 0x01, 0x02, 0x02, 0x04, 0x03, 0x02, 0x03, 0x01, 0x03,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+		0x04, 0x04, 0x04, 0x04, 0x03, 0x04, 0x03, 0x04, 0x04, 0x03, 0x04, 0x02, 0x03, 0x02, 0x03, 0x04,
+		0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+		0x04, 0x04, 0x04, 0x04, 0x03, 0x04, 0x03, 0x04, 0x04, 0x03, 0x04, 0x03, 0x01, 0x03, 0x04, 0x04,
+		0x04, 0x02, 0x04, 0x04, 0x04, 0x04,
+
+		// glyph bit offsets
+		0x00, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x32, 0x00, 0x46, 0x00, 0x5a, 0x00, 0x6e, 0x00,
+		0x73, 0x00, 0x7d, 0x00, 0x87, 0x00, 0x9b, 0x00, 0xaa, 0x00, 0xb4, 0x00, 0xc3, 0x00, 0xc8, 0x00,
+		0xd7, 0x00, 0xeb, 0x00, 0xff, 0x00, 0x13, 0x01, 0x27, 0x01, 0x3b, 0x01, 0x4f, 0x01, 0x63, 0x01,
+		0x77, 0x01, 0x8b, 0x01, 0x9f, 0x01, 0xa4, 0x01, 0xa9, 0x01, 0xb8, 0x01, 0xc7, 0x01, 0xd6, 0x01,
+		0xe5, 0x01, 0xf9, 0x01, 0x0d, 0x02, 0x21, 0x02, 0x35, 0x02, 0x49, 0x02, 0x5d, 0x02, 0x71, 0x02,
+		0x85, 0x02, 0x99, 0x02, 0x9e, 0x02, 0xb2, 0x02, 0xc6, 0x02, 0xda, 0x02, 0xee, 0x02, 0x02, 0x03,
+		0x16, 0x03, 0x2a, 0x03, 0x3e, 0x03, 0x52, 0x03, 0x66, 0x03, 0x75, 0x03, 0x89, 0x03, 0x98, 0x03,
+		0xac, 0x03, 0xc0, 0x03, 0xcf, 0x03, 0xe3, 0x03, 0xed, 0x03, 0xfc, 0x03, 0x06, 0x04, 0x15, 0x04,
+		0x29, 0x04, 0x33, 0x04, 0x47, 0x04, 0x5b, 0x04, 0x6f, 0x04, 0x83, 0x04, 0x97, 0x04, 0xab, 0x04,
+		0xbf, 0x04, 0xd3, 0x04, 0xd8, 0x04, 0xec, 0x04, 0x00, 0x05, 0x14, 0x05, 0x28, 0x05, 0x3c, 0x05,
+		0x50, 0x05, 0x64, 0x05, 0x78, 0x05, 0x8c, 0x05, 0xa0, 0x05, 0xaf, 0x05, 0xc3, 0x05, 0xd2, 0x05,
+		0xe6, 0x05, 0xfa, 0x05, 0x09, 0x06, 0x1d, 0x06, 0x2c, 0x06, 0x31, 0x06, 0x40, 0x06, 0x54, 0x06,
+		0x68, 0x06, 0x7c, 0x06, 0x86, 0x06, 0x9a, 0x06, 0xae, 0x06, 0xc2, 0x06,
+
+		// bitmap
+		0x00, 0x3b, 0x68, 0x02, 0xbe, 0xbe, 0x9e, 0x99, 0x7b, 0x05, 0xa0, 0xd2, 0x92, 0x97, 0x0d, 0x4c,
+		0xad, 0x2d, 0xed, 0x21, 0x74, 0x00, 0x60, 0x38, 0x01, 0x25, 0x48, 0xd7, 0xb2, 0xc4, 0xc4, 0x44,
+		0xd2, 0x49, 0xfc, 0x2c, 0x3d, 0x33, 0xe2, 0x3f, 0x1c, 0x3c, 0xd1, 0xd2, 0xde, 0x24, 0x44, 0xd2,
+		0xd2, 0xcd, 0x2e, 0x2c, 0xa5, 0x95, 0x11, 0x1c, 0x71, 0x11, 0x53, 0x14, 0x13, 0x4d, 0xc3, 0xb4,
+		0xfc, 0xcf, 0x4f, 0x4f, 0x34, 0xc4, 0xb7, 0x4c, 0xcf, 0x7c, 0x74, 0x7f, 0xc7, 0x44, 0x34, 0x5c,
+		0xb4, 0xcf, 0xcc, 0xfc, 0x44, 0x65, 0xa6, 0xb2, 0xa6, 0x22, 0x23, 0xe7, 0xe6, 0x66, 0x76, 0xe6,
+		0x5a, 0x66, 0x5b, 0xa7, 0xa2, 0x1a, 0x66, 0xdf, 0xa7, 0xaa, 0x5e, 0x18, 0x7b, 0xa4, 0x94, 0xcc,
+		0xcb, 0x5b, 0x6a, 0x99, 0x9f, 0x99, 0x96, 0x99, 0xb5, 0x25, 0xe2, 0xd1, 0xfd, 0x5c, 0x88, 0x9d,
+		0x5d, 0x50, 0x00, 0x00, 0x07, 0xc8, 0x0d, 0x3f, 0x33, 0xd3, 0xd3, 0xcd, 0x31, 0x2d, 0xd3, 0x33,
+		0xdf, 0x1d, 0x1f, 0xf1, 0xd1, 0x0d, 0x17, 0x2d, 0x33, 0xf3, 0x3f, 0x11, 0x19, 0x69, 0xac, 0xa9,
+		0x88, 0x88, 0xf9, 0xf9, 0x99, 0x9d, 0xb9, 0x96, 0x99, 0x96, 0xe9, 0xe8, 0x86, 0x99, 0xb7, 0xe9,
+		0xea, 0x97, 0x86, 0x1e, 0xe9, 0x25, 0x33, 0x32, 0xd6, 0xda, 0xa6, 0x67, 0xe6, 0x65, 0xa6, 0x6d,
+		0x49, 0x78, 0xb4, 0x7b, 0x59, 0x3d, 0xe4, 0xd6, 0x05, 0xa0, 0x02, 0x69, 0xf9, 0x2f, 0x8e, 0xf6,
+		0xa8, 0x9a, 0x65, 0xa5, 0xa6, 0x58, 0xa6, 0x65, 0xa4, 0x26, 0x58,
+};
+
+#endif
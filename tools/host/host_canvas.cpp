@@ -0,0 +1,140 @@
+#include "host_canvas.h"
+#include "framebuffer_ops.h"
+#include <stdio.h>
+#include <string.h>
+
+// gap between frames of a strip, in output pixels
+#define STRIP_GAP 2
+
+HostCanvas* HostCanvas::current = NULL;
+
+HostCanvas::HostCanvas(uint8_t width, uint8_t height):
+		_width(width), _height(height), _pixels(width * height * 3, 0) {}
+
+uint8_t HostCanvas::getWidth() {
+	return _width;
+}
+
+uint8_t HostCanvas::getHeight() {
+	return _height;
+}
+
+uint16_t HostCanvas::getFrameCount() {
+	return _frames.size() / _pixels.size();
+}
+
+uint8_t* HostCanvas::getFrame(uint16_t idx) {
+	return &_frames[idx * _pixels.size()];
+}
+
+void HostCanvas::set(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b) {
+	if (x < 0 || x >= _width || y < 0 || y >= _height) {
+		return;
+	}
+
+	uint8_t* pixel = &_pixels[(y * _width + x) * 3];
+
+	pixel[0] = r;
+	pixel[1] = g;
+	pixel[2] = b;
+}
+
+void HostCanvas::blend(const uint8_t* to, uint16_t pixels, uint8_t fraction) {
+	fbBlend(&_pixels[0], &_pixels[0], to, pixels * 3, fraction);
+}
+
+void HostCanvas::fillRows(int8_t top, int8_t bottom, uint8_t r, uint8_t g, uint8_t b) {
+	top = top < 0 ? 0 : top;
+	bottom = bottom > _height ? _height : bottom;
+
+	if (top < bottom) {
+		fbFill(&_pixels[top * _width * 3], (bottom - top) * _width, r, g, b);
+	}
+}
+
+void HostCanvas::clear() {
+	memset(&_pixels[0], 0, _pixels.size());
+	_frames.clear();
+}
+
+void HostCanvas::capture() {
+	_frames.insert(_frames.end(), _pixels.begin(), _pixels.end());
+}
+
+uint32_t HostCanvas::hash() {
+	// FNV-1a over all captured frames
+	uint32_t hash = 2166136261u;
+
+	for (size_t i = 0; i < _frames.size(); ++i) {
+		hash = (hash ^ _frames[i]) * 16777619u;
+	}
+
+	return hash;
+}
+
+bool HostCanvas::writeStrip(const char* path, uint8_t scale) {
+	return _writePPM(path, 0, getFrameCount(), scale);
+}
+
+bool HostCanvas::writeSequence(const char* pathPrefix, uint8_t scale) {
+	char path[256];
+
+	for (uint16_t i = 0, n = getFrameCount(); i < n; ++i) {
+		snprintf(path, sizeof(path), "%s_%04d.ppm", pathPrefix, i);
+
+		if (!_writePPM(path, i, 1, scale)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void HostCanvas::setCurrent(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b) {
+	current->set(x, y, r, g, b);
+}
+
+void HostCanvas::fillRowsCurrent(int8_t top, int8_t bottom, uint8_t r, uint8_t g, uint8_t b) {
+	current->fillRows(top, bottom, r, g, b);
+}
+
+void HostCanvas::blendCurrent(const uint8_t* to, uint16_t pixels, uint8_t fraction) {
+	current->blend(to, pixels, fraction);
+}
+
+bool HostCanvas::_writePPM(const char* path, uint16_t first, uint16_t count, uint8_t scale) {
+	FILE* file = fopen(path, "wb");
+
+	if (file == NULL) {
+		return false;
+	}
+
+	// frames are laid out left to right, separated by a dark gray gap
+	uint16_t frameWidth = _width * scale;
+	uint16_t width = count * frameWidth + (count > 0 ? (count - 1) * STRIP_GAP : 0);
+	uint16_t height = _height * scale;
+	std::vector<uint8_t> row(width * 3);
+
+	fprintf(file, "P6\n%d %d\n255\n", width, height);
+
+	for (uint16_t y = 0; y < height; ++y) {
+		uint8_t* out = &row[0];
+
+		for (uint16_t f = 0; f < count; ++f) {
+			const uint8_t* frame = getFrame(first + f) + (y / scale) * _width * 3;
+
+			if (f > 0) {
+				memset(out, 32, STRIP_GAP * 3);
+				out += STRIP_GAP * 3;
+			}
+
+			for (uint16_t x = 0; x < frameWidth; ++x, out += 3) {
+				memcpy(out, frame + (x / scale) * 3, 3);
+			}
+		}
+
+		fwrite(&row[0], 1, row.size(), file);
+	}
+
+	return fclose(file) == 0;
+}
@@ -0,0 +1,43 @@
+#ifndef __HOST_CANVAS_H
+#define __HOST_CANVAS_H
+
+#include <inttypes.h>
+#include <vector>
+#include "graphics.h"
+
+// Canvas backend which records frames into memory instead of driving the LEDs.
+class HostCanvas {
+
+public:
+
+	HostCanvas(uint8_t width, uint8_t height);
+
+	uint8_t getWidth();
+	uint8_t getHeight();
+	uint16_t getFrameCount();
+	uint8_t* getFrame(uint16_t idx);
+	void set(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b);
+	void blend(const uint8_t* to, uint16_t pixels, uint8_t fraction);
+	void fillRows(int8_t top, int8_t bottom, uint8_t r, uint8_t g, uint8_t b);
+	void clear();
+	void capture();
+	uint32_t hash();
+	bool writeStrip(const char* path, uint8_t scale);
+	bool writeSequence(const char* pathPrefix, uint8_t scale);
+
+	static HostCanvas* current;
+	static void setCurrent(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b);
+	static void fillRowsCurrent(int8_t top, int8_t bottom, uint8_t r, uint8_t g, uint8_t b);
+	static void blendCurrent(const uint8_t* to, uint16_t pixels, uint8_t fraction);
+
+private:
+
+	uint8_t _width;
+	uint8_t _height;
+	std::vector<uint8_t> _pixels;
+	std::vector<uint8_t> _frames;
+
+	bool _writePPM(const char* path, uint16_t first, uint16_t count, uint8_t scale);
+};
+
+#endif
@@ -0,0 +1,76 @@
+#include "host_display.h"
+
+// every other row runs backwards on the LED strip, see FrameBuffer::_ledIndex
+static void ledPosition(Display* display, uint16_t i, int8_t* x, int8_t* y) {
+	uint8_t width = display->getWidth();
+
+	*y = i / width;
+	*x = *y % 2 == 0 ? i % width : width - i % width - 1;
+}
+
+AnsiDisplay::AnsiDisplay(FILE* out): _out(out), _next(0), _shown(false) {}
+
+void AnsiDisplay::begin(uint8_t width, uint8_t height) {
+	Display::begin(width, height);
+
+	_pixels.assign(width * height * 3, 0);
+}
+
+void AnsiDisplay::startFrame() {
+	_next = 0;
+}
+
+void AnsiDisplay::writePixel(uint8_t r, uint8_t g, uint8_t b) {
+	if (_next >= getLedCount()) {
+		return;
+	}
+
+	int8_t x, y;
+	ledPosition(this, _next++, &x, &y);
+
+	uint8_t* pixel = &_pixels[(y * _width + x) * 3];
+
+	pixel[0] = r;
+	pixel[1] = g;
+	pixel[2] = b;
+}
+
+void AnsiDisplay::endFrame() {
+	// draw over the previous frame
+	if (_shown) {
+		fprintf(_out, "\x1b[%dA", (_height + 1) / 2);
+	}
+
+	for (uint8_t y = 0; y < _height; y += 2) {
+		for (uint8_t x = 0; x < _width; ++x) {
+			const uint8_t* top = &_pixels[(y * _width + x) * 3];
+			const uint8_t* bottom = y + 1 < _height ? top + _width * 3 : top;
+
+			// upper half block, foreground is the top pixel, background the bottom one
+			fprintf(_out, "\x1b[38;2;%d;%d;%dm\x1b[48;2;%d;%d;%dm\xe2\x96\x80\xe2\x96\x80",
+					top[0], top[1], top[2], bottom[0], bottom[1], bottom[2]);
+		}
+
+		fprintf(_out, "\x1b[0m\n");
+	}
+
+	fflush(_out);
+	_shown = true;
+}
+
+RecorderDisplay::RecorderDisplay(HostCanvas* canvas): _canvas(canvas), _next(0) {}
+
+void RecorderDisplay::startFrame() {
+	_next = 0;
+}
+
+void RecorderDisplay::writePixel(uint8_t r, uint8_t g, uint8_t b) {
+	int8_t x, y;
+	ledPosition(this, _next++, &x, &y);
+
+	_canvas->set(x, y, r, g, b);
+}
+
+void RecorderDisplay::endFrame() {
+	_canvas->capture();
+}
@@ -0,0 +1,46 @@
+#ifndef __HOST_DISPLAY_H
+#define __HOST_DISPLAY_H
+
+#include <stdio.h>
+#include <vector>
+#include "display.h"
+#include "host_canvas.h"
+
+// Renders frames to an ANSI true-color terminal, two pixel rows per line.
+class AnsiDisplay: public Display {
+
+public:
+
+	AnsiDisplay(FILE* out);
+
+	void begin(uint8_t width, uint8_t height);
+	void startFrame();
+	void writePixel(uint8_t r, uint8_t g, uint8_t b);
+	void endFrame();
+
+private:
+
+	FILE* _out;
+	std::vector<uint8_t> _pixels;
+	uint16_t _next;
+	bool _shown;
+};
+
+// Headless display which captures every frame into a canvas.
+class RecorderDisplay: public Display {
+
+public:
+
+	RecorderDisplay(HostCanvas* canvas);
+
+	void startFrame();
+	void writePixel(uint8_t r, uint8_t g, uint8_t b);
+	void endFrame();
+
+private:
+
+	HostCanvas* _canvas;
+	uint16_t _next;
+};
+
+#endif
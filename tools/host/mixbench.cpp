@@ -0,0 +1,197 @@
+// Checks the portable PMF mixer against an instruction level model of the
+// AVR assembly loop in pmf_player_arduino.cpp and benchmarks it.
+//
+// usage: mixbench [--verify cases] [--bench channels samples iterations]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "pmf_mixer.h"
+
+struct AvrState {
+	uint16_t pos; // sample_pos_int, relative to the sample start
+	uint8_t frc;
+	uint16_t speed;
+};
+
+// mirrors the assembly byte by byte, including the carries
+static void avrMix(int16_t* buffer, unsigned samples, const int8_t* data, uint16_t length,
+		uint16_t loopLength, uint8_t volume, AvrState& s) {
+
+	uint8_t* pos = (uint8_t*) buffer;
+	uint8_t* end = (uint8_t*) (buffer + samples);
+
+	do {
+		// lpm, mulsu
+		uint16_t product = (uint16_t) ((int16_t) data[s.pos] * (int16_t) volume);
+		uint8_t r1 = product >> 8;
+
+		// lsl, sbc
+		uint8_t upper = r1 & 0x80 ? 0xff : 0x00;
+
+		// add, adc
+		uint16_t lo = pos[0] + r1;
+		pos[0] = lo;
+		pos[1] = pos[1] + upper + (lo >> 8);
+		pos += 2;
+
+		// add, adc, adc
+		uint16_t frc = s.frc + (s.speed & 0xff);
+		s.frc = frc;
+		s.pos += (s.speed >> 8) + (frc >> 8);
+
+		// cp, cpc, brcc
+		if (s.pos >= length) {
+			s.pos -= loopLength;
+
+			if (loopLength == 0) {
+				s.speed = 0;
+				break;
+			}
+		}
+	} while (pos != end);
+}
+
+static uint32_t random32() {
+	return ((uint32_t) rand() << 16) ^ (uint32_t) rand();
+}
+
+static int verify(unsigned cases) {
+	unsigned mismatches = 0;
+
+	for (unsigned c = 0; c < cases; ++c) {
+		uint16_t length = 1 + random32() % 4000;
+		uint16_t loopLength = rand() % 3 == 0 ? 0 : 1 + random32() % length;
+		unsigned samples = 1 + rand() % 400;
+		uint16_t speed = rand() % 4 == 0 ? random32() % 0x4000 : 1 + random32() % 0x300;
+
+		// loops shorter than a step leave the sample, the AVR then reads the
+		// following flash bytes, here it gets room for them
+		std::vector<int8_t> data(length + samples * ((speed >> 8) + 1) + 4);
+
+		for (size_t i = 0; i < data.size(); ++i) {
+			data[i] = rand();
+		}
+
+		std::vector<int16_t> initial(samples);
+
+		for (unsigned i = 0; i < samples; ++i) {
+			initial[i] = rand();
+		}
+
+		AvrState avr;
+		avr.pos = random32() % length;
+		avr.frc = rand();
+		avr.speed = speed;
+		uint8_t volume = rand();
+
+		pmf_mixer_channel chl;
+		chl.data = &data[0];
+		chl.pos = ((uint32_t) avr.pos << 8) | avr.frc;
+		chl.speed = avr.speed;
+		chl.length = length;
+		chl.loop_length = loopLength;
+		chl.volume = volume;
+		pmf_mixer_channel scalar = chl;
+
+		std::vector<int16_t> expected = initial, mixed = initial, mixedScalar = initial;
+
+		avrMix(&expected[0], samples, &data[0], length, loopLength, volume, avr);
+		pmf_mix_channel(&mixed[0], samples, chl);
+		pmf_mix_channel_scalar(&mixedScalar[0], samples, scalar);
+
+		bool same = expected == mixed && expected == mixedScalar
+				&& chl.pos == (((uint32_t) avr.pos << 8) | avr.frc) && chl.speed == avr.speed
+				&& scalar.pos == chl.pos && scalar.speed == chl.speed;
+
+		if (!same) {
+			if (mismatches++ < 10) {
+				fprintf(stderr, "case %u: length %u, loop %u, speed 0x%04x, volume %u, samples %u\n",
+						c, length, loopLength, chl.speed, volume, samples);
+			}
+		}
+	}
+
+	printf("%u cases, %u mismatches\n", cases, mismatches);
+
+	return mismatches > 0;
+}
+
+static void bench(unsigned channels, unsigned samples, unsigned iterations) {
+	std::vector<int8_t> data(8192);
+
+	for (size_t i = 0; i < data.size(); ++i) {
+		data[i] = rand();
+	}
+
+	std::vector<pmf_mixer_channel> state(channels);
+	std::vector<int16_t> buffer(samples);
+
+	for (unsigned pass = 0; pass < 2; ++pass) {
+		for (unsigned c = 0; c < channels; ++c) {
+			state[c].data = &data[0];
+			state[c].pos = 0;
+			state[c].speed = 0x80 + c * 0x31;
+			state[c].length = 8000;
+			state[c].loop_length = 4000;
+			state[c].volume = 200;
+		}
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+		for (unsigned i = 0; i < iterations; ++i) {
+			memset(&buffer[0], 0, samples * sizeof(int16_t));
+
+			for (unsigned c = 0; c < channels; ++c) {
+				if (pass == 0) {
+					pmf_mix_channel_scalar(&buffer[0], samples, state[c]);
+				} else {
+					pmf_mix_channel(&buffer[0], samples, state[c]);
+				}
+			}
+		}
+
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		double rate = (double) channels * samples * iterations / seconds;
+
+		printf("%-8s %8.1f M channel-samples/s (%.0fx real time at 22050 Hz per channel)\n",
+				pass == 0 ? "scalar" : "mixer", rate / 1e6, rate / channels / 22050);
+	}
+}
+
+int main(int argc, char** argv) {
+	unsigned cases = 0;
+	unsigned channels = 0, samples = 0, iterations = 0;
+
+	for (int i = 1; i < argc; ++i) {
+		if (!strcmp(argv[i], "--verify") && i + 1 < argc) {
+			cases = atoi(argv[++i]);
+		} else if (!strcmp(argv[i], "--bench") && i + 3 < argc) {
+			channels = atoi(argv[++i]);
+			samples = atoi(argv[++i]);
+			iterations = atoi(argv[++i]);
+		} else {
+			fprintf(stderr, "usage: mixbench [--verify cases] [--bench channels samples iterations]\n");
+			return 1;
+		}
+	}
+
+	if (cases == 0 && iterations == 0) {
+		cases = 100000;
+		channels = 16;
+		samples = 200;
+		iterations = 20000;
+	}
+
+	srand(1);
+
+	int result = cases > 0 ? verify(cases) : 0;
+
+	if (iterations > 0 && channels > 0 && samples > 0) {
+		bench(channels, samples, iterations);
+	}
+
+	return result;
+}
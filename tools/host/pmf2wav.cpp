@@ -0,0 +1,224 @@
+// Renders the PMF songs to 8-bit mono WAV files through the real player, the
+// samples are the ones the DAC would get. Songs render in parallel, one
+// player per thread. Rendering stops when the song loops back or after the
+// time limit. With --hash only the sample hash of each song is printed.
+//
+// usage: pmf2wav [-o dir] [-t seconds] [-j threads] [--hash] [tetris|loveya|dreams|chippy ...]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "pmf_player.h"
+#include "audio_data.h"
+
+// rendered per step between the end of song checks
+#define RENDER_CHUNK 1000
+
+static const struct {
+	const char* name;
+	const uint8_t* data;
+} songs[] = {
+	{ "tetris", pmfTetris },
+	{ "loveya", pmfLoveYa },
+	{ "dreams", pmfLoveInMyDreams },
+	{ "chippy", pmfChippy }
+};
+
+#define SONG_COUNT (sizeof(songs) / sizeof(songs[0]))
+
+struct Result {
+	std::vector<uint8_t> samples;
+	uint8_t channels;
+	bool looped;
+	double seconds; // render time
+	uint32_t hash;
+};
+
+static void writeLE(FILE* file, uint32_t value, uint8_t bytes) {
+	for (uint8_t i = 0; i < bytes; ++i) {
+		fputc((value >> (i * 8)) & 0xff, file);
+	}
+}
+
+static bool writeWav(const char* path, const std::vector<uint8_t>& samples) {
+	FILE* file = fopen(path, "wb");
+
+	if (file == NULL) {
+		return false;
+	}
+
+	uint32_t size = samples.size();
+
+	fwrite("RIFF", 1, 4, file);
+	writeLE(file, 36 + size, 4);
+	fwrite("WAVEfmt ", 1, 8, file);
+	writeLE(file, 16, 4); // format chunk size
+	writeLE(file, 1, 2); // PCM
+	writeLE(file, 1, 2); // mono
+	writeLE(file, pmfplayer_sampling_rate, 4);
+	writeLE(file, pmfplayer_sampling_rate, 4); // bytes per second
+	writeLE(file, 1, 2); // block align
+	writeLE(file, 8, 2); // bits per sample
+	fwrite("data", 1, 4, file);
+	writeLE(file, size, 4);
+
+	bool written = fwrite(&samples[0], 1, size, file) == size;
+
+	return fclose(file) == 0 && written;
+}
+
+static void render(const uint8_t* song, uint32_t maxSamples, Result* result) {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	pmf_player player;
+	player.start(song);
+
+	result->channels = player.num_playback_channels();
+	result->looped = false;
+	result->samples.clear();
+
+	uint8_t lastPos = player.playlist_pos();
+
+	while (result->samples.size() < maxSamples) {
+		size_t size = result->samples.size();
+		result->samples.resize(size + RENDER_CHUNK);
+		player.render(&result->samples[size], RENDER_CHUNK);
+
+		// the playlist position only goes back when the song loops
+		uint8_t pos = player.playlist_pos();
+
+		if (pos < lastPos) {
+			result->looped = true;
+			break;
+		}
+
+		lastPos = pos;
+	}
+
+	player.stop();
+
+	result->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	// FNV-1a, for diffing renders
+	result->hash = 2166136261u;
+
+	for (size_t i = 0; i < result->samples.size(); ++i) {
+		result->hash = (result->hash ^ result->samples[i]) * 16777619u;
+	}
+}
+
+static void usage() {
+	fprintf(stderr, "usage: pmf2wav [-o dir] [-t seconds] [-j threads] [--hash] [song ...]\n");
+	fprintf(stderr, "songs:");
+
+	for (uint8_t i = 0; i < SONG_COUNT; ++i) {
+		fprintf(stderr, " %s", songs[i].name);
+	}
+
+	fprintf(stderr, "\n");
+	exit(1);
+}
+
+int main(int argc, char** argv) {
+	const char* outDir = ".";
+	uint32_t maxSeconds = 600;
+	unsigned threads = std::thread::hardware_concurrency();
+	bool hashOnly = false;
+	std::vector<uint8_t> selected;
+
+	for (int i = 1; i < argc; ++i) {
+		if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+			outDir = argv[++i];
+		} else if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+			maxSeconds = atol(argv[++i]);
+		} else if (!strcmp(argv[i], "-j") && i + 1 < argc) {
+			threads = atoi(argv[++i]);
+		} else if (!strcmp(argv[i], "--hash")) {
+			hashOnly = true;
+		} else {
+			uint8_t s = 0;
+
+			while (s < SONG_COUNT && strcmp(argv[i], songs[s].name)) {
+				++s;
+			}
+
+			if (s == SONG_COUNT) {
+				usage();
+			}
+
+			selected.push_back(s);
+		}
+	}
+
+	if (maxSeconds == 0) {
+		usage();
+	}
+
+	if (selected.empty()) {
+		for (uint8_t s = 0; s < SONG_COUNT; ++s) {
+			selected.push_back(s);
+		}
+	}
+
+	threads = threads == 0 ? 1 : threads < selected.size() ? threads : selected.size();
+
+	std::vector<Result> results(selected.size());
+	std::atomic<unsigned> next(0);
+	std::vector<std::thread> workers;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	// every worker takes the next song until none are left
+	for (unsigned t = 0; t < threads; ++t) {
+		workers.push_back(std::thread([&]() {
+			for (unsigned i; (i = next++) < selected.size();) {
+				render(songs[selected[i]].data, maxSeconds * pmfplayer_sampling_rate, &results[i]);
+			}
+		}));
+	}
+
+	for (unsigned t = 0; t < threads; ++t) {
+		workers[t].join();
+	}
+
+	double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	double audio = 0;
+	int status = 0;
+
+	for (size_t i = 0; i < selected.size(); ++i) {
+		Result& result = results[i];
+		double seconds = (double) result.samples.size() / pmfplayer_sampling_rate;
+		char path[256];
+
+		snprintf(path, sizeof(path), "%s/%s.wav", outDir, songs[selected[i]].name);
+
+		if (!writeWav(path, result.samples)) {
+			fprintf(stderr, "cannot write %s\n", path);
+			status = 1;
+		}
+
+		if (hashOnly) {
+			printf("%-8s %08x\n", songs[selected[i]].name, result.hash);
+			continue;
+		}
+
+		printf("%-8s %2u ch %7.1f s%s %8.1f ms %7.0fx real time %5.1f us/s  %08x\n",
+				songs[selected[i]].name, result.channels, seconds, result.looped ? "" : "+",
+				result.seconds * 1000, seconds / result.seconds,
+				result.seconds * 1e6 / seconds, result.hash);
+
+		audio += seconds;
+	}
+
+	if (hashOnly) {
+		return status;
+	}
+
+	printf("%u threads, %.1f s of audio in %.1f ms, %.0fx real time\n",
+			threads, audio, wall * 1000, audio / wall);
+
+	return status;
+}
@@ -0,0 +1,80 @@
+// Checks the fixed-point pitch tables in pmf_pitch.cpp against the float
+// exp2() approximation the player used before.
+//
+// usage: pmfpitch
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "pmf_player.h"
+#include "pmf_pitch.h"
+
+// the removed float path of pmf_player.cpp
+static float floatExp2(float x) {
+	int adjustment = 0;
+	uint8_t intArg = uint8_t(x);
+	x -= intArg;
+	if (x > 0.5f) {
+		adjustment = 1;
+		x -= 0.5f;
+	}
+	float x2 = x * x;
+	float q = 20.8189237930062f + x2;
+	float xp = x * (7.2152891521493f + 0.0576900723731f * x2);
+	float res = (1 << intArg) * (q + xp) / (q - xp);
+	if (adjustment)
+		res *= 1.4142135623730950488f;
+	return res;
+}
+
+static uint16_t floatNotePeriod(uint8_t noteIdx, bool linear) {
+	if (linear)
+		return 7680 - noteIdx * 64;
+	return uint16_t(27392.0f / floatExp2(noteIdx / 12.0f) + 0.5f);
+}
+
+static uint16_t floatSampleSpeed(uint16_t notePeriod, uint16_t c4hz, bool linear) {
+	if (linear)
+		return uint16_t((c4hz * 32.0f / pmfplayer_sampling_rate) * floatExp2(float(7680 - notePeriod) / 768.0f) + 0.5f);
+	return uint16_t((c4hz * 1024.0f * 7093789.2 / pmfplayer_sampling_rate) / (8363.0f * notePeriod) + 0.5f);
+}
+
+struct MaxError {
+	int error;
+	unsigned at;
+	unsigned c4hz;
+};
+
+static void track(MaxError& max, int a, int b, unsigned at, unsigned c4hz) {
+	int error = abs(a - b);
+	if (error > max.error) {
+		max.error = error;
+		max.at = at;
+		max.c4hz = c4hz;
+	}
+}
+
+int main() {
+	static const uint16_t c4hzs[] = {4181, 8363, 11025, 16726, 22050, 33452};
+
+	MaxError amigaPeriod = {0, 0, 0};
+	for (unsigned n = 0; n < pmfcfg_num_note_periods; ++n)
+		track(amigaPeriod, pmf_get_note_period(n, false), floatNotePeriod(n, false), n, 0);
+
+	MaxError linearSpeed = {0, 0, 0}, amigaSpeed = {0, 0, 0};
+	for (unsigned c = 0; c < sizeof(c4hzs) / sizeof(*c4hzs); ++c) {
+		uint16_t c4hz = c4hzs[c];
+
+		// speeds above 16 bits wrap in both paths, skip them
+		for (unsigned p = 0; p <= 7680; ++p)
+			if (floatSampleSpeed(p, c4hz, true) < 65000)
+				track(linearSpeed, pmf_get_sample_speed(p, c4hz, true), floatSampleSpeed(p, c4hz, true), p, c4hz);
+		for (unsigned p = pmf_min_period; p <= pmf_max_period; ++p)
+			if (floatSampleSpeed(p, c4hz, false) < 65000)
+				track(amigaSpeed, pmf_get_sample_speed(p, c4hz, false), floatSampleSpeed(p, c4hz, false), p, c4hz);
+	}
+
+	printf("amiga note period  max error %d (note %u)\n", amigaPeriod.error, amigaPeriod.at);
+	printf("linear speed       max error %d (period %u, c4hz %u)\n", linearSpeed.error, linearSpeed.at, linearSpeed.c4hz);
+	printf("amiga speed        max error %d (period %u, c4hz %u)\n", amigaSpeed.error, amigaSpeed.at, amigaSpeed.c4hz);
+	return amigaPeriod.error > 1 || linearSpeed.error > 1 || amigaSpeed.error > 1 ? 1 : 0;
+}
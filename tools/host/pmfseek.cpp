@@ -0,0 +1,189 @@
+// Generates the PMF seek indices of the songs in audio_data.h and checks
+// that seeking through them decodes the same as skipping rows one by one.
+//
+// usage: pmfseek [-r rows] [-o file]   writes pmf_seek_data.h
+//        pmfseek --verify [-r rows]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "pmf_player.h"
+#include "audio_data.h"
+
+#define DEFAULT_ROWS_PER_SNAPSHOT 32
+#define MAX_INDEX_SIZE 65536
+
+// samples compared after a seek, a few rows at the usual tempos
+#define SEEK_COMPARE_SAMPLES 4096
+#define SEEK_ROWS 64
+
+// whole song comparison
+#define SONG_MAX_SAMPLES (600 * pmfplayer_sampling_rate)
+#define SONG_CHUNK 1000
+
+static const struct {
+	const char* name;
+	const char* array;
+	const uint8_t* data;
+} songs[] = {
+	{ "tetris", "pmfTetrisSeek", pmfTetris },
+	{ "loveya", "pmfLoveYaSeek", pmfLoveYa },
+	{ "dreams", "pmfLoveInMyDreamsSeek", pmfLoveInMyDreams },
+	{ "chippy", "pmfChippySeek", pmfChippy }
+};
+
+#define SONG_COUNT (sizeof(songs) / sizeof(songs[0]))
+
+static std::vector<uint8_t> buildIndex(const uint8_t* song, uint8_t rowsPerSnapshot) {
+	std::vector<uint8_t> index(MAX_INDEX_SIZE);
+	pmf_player player;
+	player.start(song);
+	index.resize(player.build_seek_index(&index[0], index.size(), rowsPerSnapshot));
+	return index;
+}
+
+// FNV-1a of a song rendered until it loops
+static uint32_t songHash(const uint8_t* song, const uint8_t* index) {
+	pmf_player player;
+	player.start(song, index);
+
+	std::vector<uint8_t> samples(SONG_CHUNK);
+	uint32_t hash = 2166136261u;
+	uint8_t lastPos = player.playlist_pos();
+
+	for (uint32_t rendered = 0; rendered < SONG_MAX_SAMPLES; rendered += SONG_CHUNK) {
+		player.render(&samples[0], SONG_CHUNK);
+
+		for (unsigned i = 0; i < SONG_CHUNK; ++i) {
+			hash = (hash ^ samples[i]) * 16777619u;
+		}
+
+		uint8_t pos = player.playlist_pos();
+
+		if (pos < lastPos) {
+			break;
+		}
+
+		lastPos = pos;
+	}
+
+	return hash;
+}
+
+static bool verify(uint8_t rowsPerSnapshot) {
+	bool ok = true;
+
+	for (uint8_t s = 0; s < SONG_COUNT; ++s) {
+		std::vector<uint8_t> index = buildIndex(songs[s].data, rowsPerSnapshot);
+
+		if (index.empty()) {
+			printf("%-8s index does not fit\n", songs[s].name);
+			ok = false;
+			continue;
+		}
+
+		bool same = songHash(songs[s].data, NULL) == songHash(songs[s].data, &index[0]);
+
+		// seek every row of every playlist position with and without the index
+		uint16_t playlistLength = pgm_read_word(songs[s].data + 14);
+		unsigned mismatches = 0;
+
+		for (uint16_t pos = 0; pos < playlistLength; ++pos) {
+			for (uint8_t row = 0; row < SEEK_ROWS; ++row) {
+				pmf_player linear, indexed;
+				linear.start(songs[s].data);
+				indexed.start(songs[s].data, &index[0]);
+				linear.seek(pos, row);
+				indexed.seek(pos, row);
+
+				uint8_t a[SEEK_COMPARE_SAMPLES], b[SEEK_COMPARE_SAMPLES];
+				linear.render(a, SEEK_COMPARE_SAMPLES);
+				indexed.render(b, SEEK_COMPARE_SAMPLES);
+
+				if (memcmp(a, b, SEEK_COMPARE_SAMPLES) != 0) {
+					++mismatches;
+				}
+			}
+		}
+
+		printf("%-8s %5u bytes, song %s, %u of %u seeks differ\n", songs[s].name, (unsigned) index.size(),
+				same ? "identical" : "differs", mismatches, playlistLength * SEEK_ROWS);
+		ok = ok && same && !mismatches;
+	}
+
+	return ok;
+}
+
+static bool writeHeader(const char* path, uint8_t rowsPerSnapshot) {
+	FILE* file = fopen(path, "w");
+
+	if (file == NULL) {
+		return false;
+	}
+
+	fprintf(file, "#ifndef __PMF_SEEK_DATA_H\n#define __PMF_SEEK_DATA_H\n\n#include <Arduino.h>\n\n");
+	fprintf(file, "// seek indices of the songs in audio_data.h with track snapshots every %u rows,\n", rowsPerSnapshot);
+	fprintf(file, "// generated by tools/host/pmfseek\n");
+	bool ok = true;
+
+	for (uint8_t s = 0; s < SONG_COUNT; ++s) {
+		std::vector<uint8_t> index = buildIndex(songs[s].data, rowsPerSnapshot);
+
+		if (index.empty()) {
+			fprintf(stderr, "%s: index does not fit\n", songs[s].name);
+			ok = false;
+			break;
+		}
+
+		fprintf(file, "\nconst uint8_t PROGMEM %s[] = {", songs[s].array);
+
+		for (size_t i = 0; i < index.size(); ++i) {
+			fprintf(file, "%s0x%02x%s", i % 16 ? " " : "\n\t", index[i], i + 1 < index.size() ? "," : "");
+		}
+
+		fprintf(file, "\n};\n");
+		printf("%-8s %5u bytes\n", songs[s].name, (unsigned) index.size());
+	}
+
+	fprintf(file, "\n#endif\n");
+	return fclose(file) == 0 && ok;
+}
+
+static void usage() {
+	fprintf(stderr, "usage: pmfseek [-r rows] [-o file]\n       pmfseek --verify [-r rows]\n");
+	exit(1);
+}
+
+int main(int argc, char** argv) {
+	const char* outPath = "pmf_seek_data.h";
+	unsigned rowsPerSnapshot = DEFAULT_ROWS_PER_SNAPSHOT;
+	bool verifyOnly = false;
+
+	for (int i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "--verify") == 0) {
+			verifyOnly = true;
+		} else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+			rowsPerSnapshot = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+			outPath = argv[++i];
+		} else {
+			usage();
+		}
+	}
+
+	if (rowsPerSnapshot < 1 || rowsPerSnapshot > 255) {
+		usage();
+	}
+
+	if (verifyOnly) {
+		return verify(rowsPerSnapshot) ? 0 : 1;
+	}
+
+	if (!writeHeader(outPath, rowsPerSnapshot)) {
+		fprintf(stderr, "cannot write %s\n", outPath);
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,519 @@
+// Renders the game graphics on the host into PPM strips or frame sequences,
+// prints frame hashes and benchmarks the drawing code. With --display the
+// frames are replayed through the frame buffer into a display backend: the
+// terminal, or a recorder whose frames (as sent to the LEDs) are written out
+// instead. Either way the cost of every present() is reported.
+//
+// usage: render [-o dir] [-n frames] [-s scale] [--sequence] [--hash]
+//               [--bench iterations] [--display ansi|record]
+//               [tetris|catris|scroll|atlas|pause|transition|particles|game ...]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include "host_canvas.h"
+#include "host_display.h"
+#include "framebuffer.h"
+#include "timer.h"
+#include "graphics.h"
+#include "tetris.h"
+#include "catris.h"
+#include "transition.h"
+#include "particles.h"
+#include "compositor.h"
+#include "icons.h"
+#include "icon_data.h"
+#include "font_data.h"
+#include "font_atlas_data.h"
+
+#define CANVAS_WIDTH  10
+#define CANVAS_HEIGHT 20
+
+// virtual time advanced by one display frame (60 fps) per rendered frame
+#define FRAME_MILLIS 17
+
+static unsigned long hostMillis = 0;
+
+unsigned long Timer::_millis() {
+	return hostMillis;
+}
+
+static uint8_t directMemRead(uint8_t* addr) {
+	return *addr;
+}
+
+static void tetrisEvent(TetrisEvent event, uint8_t data) {}
+
+typedef void (*scene) (HostCanvas* canvas, uint16_t frames, bool capture);
+
+static void renderTetris(HostCanvas* canvas, uint16_t frames, bool capture) {
+	srand(1);
+
+	Tetris tetris(canvas->getWidth(), canvas->getHeight(), &tetrisEvent);
+	tetris.reset();
+
+	for (uint16_t f = 0; f < frames; ++f, hostMillis += FRAME_MILLIS) {
+		// scripted input, a move every few frames
+		switch (f % 24) {
+		case 4: tetris.rotateClockWise(); break;
+		case 8: tetris.moveLeft(); break;
+		case 12: tetris.moveRight(); break;
+		case 16: tetris.moveRight(); break;
+		case 20: tetris.moveDown(); break;
+		}
+
+		tetris.update();
+		tetris.draw(&HostCanvas::setCurrent);
+
+		if (capture) {
+			canvas->capture();
+		}
+	}
+}
+
+static void renderCatris(HostCanvas* canvas, uint16_t frames, bool capture) {
+	Catris catris(&directMemRead, &directMemRead);
+	catris.setAnimation(Catris::Anim::Happy);
+	catris.setText("    Hello from the host!");
+
+	for (uint16_t f = 0; f < frames; ++f, hostMillis += FRAME_MILLIS) {
+		catris.update();
+		catris.draw(&HostCanvas::setCurrent, &HostCanvas::fillRowsCurrent);
+
+		if (capture) {
+			canvas->capture();
+		}
+	}
+}
+
+static void renderScroll(HostCanvas* canvas, uint16_t frames, bool capture) {
+	ScrollText text(0, 7, canvas->getWidth(), &directMemRead, (uint8_t*) font4x5);
+	text.setText("    The quick brown fox jumps over the lazy dog. 0123456789");
+
+	uint8_t color[3];
+
+	for (uint16_t f = 0; f < frames; ++f, hostMillis += FRAME_MILLIS) {
+		hsv2rgb8(f * 4, 255, 255, color);
+		text.draw(&HostCanvas::setCurrent, color);
+
+		if (f % 4 == 3) {
+			text.scroll();
+		}
+
+		if (capture) {
+			canvas->capture();
+		}
+	}
+}
+
+static void renderAtlas(HostCanvas* canvas, uint16_t frames, bool capture) {
+	ScrollText text(0, 7, canvas->getWidth(), &directMemRead, (uint8_t*) font4x5Atlas);
+	text.setText("    Atlas font: J\xf3 \xe9jszak\xe1t, \xfcgyes \xf6r\xfcl\xe9s! 0123456789");
+
+	uint8_t color[3];
+
+	for (uint16_t f = 0; f < frames; ++f, hostMillis += FRAME_MILLIS) {
+		hsv2rgb8(f * 4, 255, 255, color);
+		text.draw(&HostCanvas::setCurrent, color);
+
+		if (f % 4 == 3) {
+			text.scroll();
+		}
+
+		if (capture) {
+			canvas->capture();
+		}
+	}
+}
+
+static void renderPause(HostCanvas* canvas, uint16_t frames, bool capture) {
+	Icon pauseSign(&directMemRead, pauseIcon);
+	uint8_t color[3];
+
+	for (uint16_t f = 0; f < frames; ++f, hostMillis += FRAME_MILLIS) {
+		hsv2rgb8(f * 4, 255, 255, color);
+		pauseSign.draw(&HostCanvas::setCurrent, 1, 6, color);
+
+		if (capture) {
+			canvas->capture();
+		}
+	}
+}
+
+static Transition* currentTransition;
+
+static void setTransition(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b) {
+	uint8_t width = HostCanvas::current->getWidth();
+
+	if (x < 0 || x >= width || y < 0 || y >= HostCanvas::current->getHeight()) {
+		return;
+	}
+
+	// the canvas has no gamma and runs row by row
+	uint8_t* pixel = currentTransition->getBuffer() + (y * width + x) * 3;
+
+	pixel[0] = r;
+	pixel[1] = g;
+	pixel[2] = b;
+}
+
+static void fillTransitionRows(int8_t top, int8_t bottom, uint8_t r, uint8_t g, uint8_t b) {
+	uint8_t width = HostCanvas::current->getWidth();
+
+	top = top < 0 ? 0 : top;
+	bottom = bottom > HostCanvas::current->getHeight() ? HostCanvas::current->getHeight() : bottom;
+
+	if (top < bottom) {
+		fbFill(currentTransition->getBuffer() + top * width * 3, (bottom - top) * width, r, g, b);
+	}
+}
+
+static void renderTransition(HostCanvas* canvas, uint16_t frames, bool capture) {
+	srand(1);
+
+	Transition transition(canvas->getWidth(), canvas->getHeight());
+	Catris catris(&directMemRead, &directMemRead);
+	Tetris tetris(canvas->getWidth(), canvas->getHeight(), &tetrisEvent);
+	currentTransition = &transition;
+
+	catris.setAnimation(Catris::Anim::Happy);
+	catris.setText("    Ready?");
+	tetris.reset();
+
+	// the transition starts from what the canvas shows
+	catris.draw(&HostCanvas::setCurrent, &HostCanvas::fillRowsCurrent);
+
+	// catris blends into tetris in the first half and wipes back in the second
+	for (uint16_t f = 0; f < frames; ++f, hostMillis += FRAME_MILLIS) {
+		bool toTetris = f < frames / 2;
+
+		if (f == 0 || f == frames / 2) {
+			transition.begin(toTetris ? Transition::Blend : Transition::Wipe, frames / 4);
+			catris.invalidate();
+		}
+
+		::canvas screen = transition.isRunning() ? &setTransition : &HostCanvas::setCurrent;
+		rowsCanvas screenRows = transition.isRunning() ? &fillTransitionRows : &HostCanvas::fillRowsCurrent;
+
+		if (toTetris) {
+			tetris.update();
+			tetris.draw(screen);
+		} else {
+			catris.update();
+			catris.draw(screen, screenRows);
+		}
+
+		transition.render(&HostCanvas::blendCurrent);
+
+		if (capture) {
+			canvas->capture();
+		}
+	}
+}
+
+static void renderParticles(HostCanvas* canvas, uint16_t frames, bool capture) {
+	srand(1);
+
+	static const uint8_t white[3] = { 255, 255, 255 };
+	Particles particles(canvas->getWidth(), canvas->getHeight());
+
+	for (uint16_t f = 0; f < frames; ++f, hostMillis += FRAME_MILLIS) {
+		if (f % 40 == 0) {
+			particles.emitRow(canvas->getHeight() - 1, white);
+			particles.emitRow(canvas->getHeight() - 2, white);
+		}
+
+		particles.update();
+
+		for (int8_t y = 0; y < canvas->getHeight(); ++y) {
+			for (int8_t x = 0; x < canvas->getWidth(); ++x) {
+				canvas->set(x, y, 0, 0, 0);
+			}
+		}
+
+		particles.draw(&HostCanvas::setCurrent);
+
+		if (capture) {
+			canvas->capture();
+		}
+	}
+}
+
+static Tetris* gameTetris;
+static Particles* gameParticles;
+static Compositor* gameCompositor;
+
+static void gameEvent(TetrisEvent event, uint8_t data) {
+	static const uint8_t white[3] = { 255, 255, 255 };
+
+	if (event == TetrisEvent::RowsCompleted || event == TetrisEvent::LevelUp) {
+		for (uint8_t i = 0; i < gameTetris->getClearedRowCount(); ++i) {
+			gameParticles->emitRow(gameTetris->getClearedRow(i), white);
+		}
+	}
+}
+
+static void setGameLayer(int8_t x, int8_t y, uint8_t r, uint8_t g, uint8_t b) {
+	gameCompositor->set(x, y, r, g, b);
+}
+
+// tetris drawn layer by layer through the compositor, as the game does
+static void renderGame(HostCanvas* canvas, uint16_t frames, bool capture) {
+	srand(1);
+
+	static const uint8_t white[3] = { 255, 255, 255 };
+	Icon pauseSign(&directMemRead, pauseIcon);
+	Particles particles(canvas->getWidth(), canvas->getHeight());
+	Compositor compositor(canvas->getWidth(), canvas->getHeight());
+	Tetris tetris(canvas->getWidth(), canvas->getHeight(), &gameEvent);
+
+	gameTetris = &tetris;
+	gameParticles = &particles;
+	gameCompositor = &compositor;
+
+	tetris.reset();
+	compositor.invalidate();
+
+	for (uint16_t f = 0; f < frames; ++f, hostMillis += FRAME_MILLIS) {
+		switch (f % 24) {
+		case 4: tetris.rotateClockWise(); break;
+		case 8: tetris.moveLeft(); break;
+		case 12: tetris.moveRight(); break;
+		case 16: tetris.moveRight(); break;
+		case 20: tetris.moveDown(); break;
+		}
+
+		// the scripted game clears no rows this early, burst the floor instead
+		if (f % 60 == 30) {
+			particles.emitRow(canvas->getHeight() - 1, white);
+		}
+
+		// paused for a stretch of every 64 frames
+		tetris.setPaused(f % 64 >= 40 && f % 64 < 56);
+
+		tetris.update();
+		particles.update();
+
+		compositor.begin(Compositor::Pile);
+		tetris.drawPile(&setGameLayer);
+		compositor.end();
+
+		compositor.begin(Compositor::Ghost);
+		tetris.drawGhost(&setGameLayer);
+		compositor.end();
+
+		compositor.begin(Compositor::Piece);
+		tetris.drawPiece(&setGameLayer);
+		compositor.end();
+
+		compositor.begin(Compositor::Particles);
+		particles.draw(&setGameLayer);
+		compositor.end();
+
+		compositor.begin(Compositor::Overlay);
+
+		if (tetris.isPaused()) {
+			uint8_t color[3];
+			hsv2rgb8(f * 4, 255, 255, color);
+			pauseSign.draw(&setGameLayer, 1, 6, color);
+		}
+
+		compositor.end();
+
+		compositor.compose(&HostCanvas::setCurrent);
+
+		if (capture) {
+			canvas->capture();
+		}
+	}
+}
+
+// replays the captured frames through a frame buffer at the display frame rate
+static void presentFrames(HostCanvas* canvas, Display* display, bool realTime) {
+	FrameBuffer frameBuffer(canvas->getWidth(), canvas->getHeight());
+	frameBuffer.begin(display);
+
+	double total = 0, max = 0;
+
+	for (uint16_t f = 0; f < canvas->getFrameCount(); ++f) {
+		const uint8_t* pixel = canvas->getFrame(f);
+
+		for (int8_t y = 0; y < canvas->getHeight(); ++y) {
+			for (int8_t x = 0; x < canvas->getWidth(); ++x, pixel += 3) {
+				frameBuffer.setUnchecked(x, y, pixel[0], pixel[1], pixel[2]);
+			}
+		}
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		frameBuffer.present();
+
+		// async builds write the frame a chunk at a time, like the main loop
+		while (display->isBusy()) {
+			frameBuffer.update();
+		}
+
+		double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+		total += us;
+		max = us > max ? us : max;
+
+		if (realTime) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(FRAME_MILLIS));
+		}
+	}
+
+	fprintf(stderr, "presented %u of %u frames, present() %.1f us avg, %.1f us max\n",
+			frameBuffer.getFramesPresented(), canvas->getFrameCount(),
+			total / canvas->getFrameCount(), max);
+}
+
+static const struct {
+	const char* name;
+	scene render;
+} scenes[] = {
+	{ "tetris", &renderTetris },
+	{ "catris", &renderCatris },
+	{ "scroll", &renderScroll },
+	{ "atlas", &renderAtlas },
+	{ "pause", &renderPause },
+	{ "transition", &renderTransition },
+	{ "particles", &renderParticles },
+	{ "game", &renderGame }
+};
+
+#define SCENE_COUNT (sizeof(scenes) / sizeof(scenes[0]))
+
+static void usage() {
+	fprintf(stderr, "usage: render [-o dir] [-n frames] [-s scale] [--sequence] [--hash] [--bench iterations] [--display ansi|record] [scene ...]\n");
+	fprintf(stderr, "scenes:");
+
+	for (uint8_t i = 0; i < SCENE_COUNT; ++i) {
+		fprintf(stderr, " %s", scenes[i].name);
+	}
+
+	fprintf(stderr, "\n");
+	exit(1);
+}
+
+int main(int argc, char** argv) {
+	const char* outDir = ".";
+	uint16_t frames = 60;
+	uint8_t scale = 8;
+	bool sequence = false;
+	bool hash = false;
+	uint32_t bench = 0;
+	const char* displayName = NULL;
+	bool selected[SCENE_COUNT] = { false };
+	bool any = false;
+
+	for (int i = 1; i < argc; ++i) {
+		if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+			outDir = argv[++i];
+		} else if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+			frames = atoi(argv[++i]);
+		} else if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+			scale = atoi(argv[++i]);
+		} else if (!strcmp(argv[i], "--sequence")) {
+			sequence = true;
+		} else if (!strcmp(argv[i], "--hash")) {
+			hash = true;
+		} else if (!strcmp(argv[i], "--bench") && i + 1 < argc) {
+			bench = atol(argv[++i]);
+		} else if (!strcmp(argv[i], "--display") && i + 1 < argc) {
+			displayName = argv[++i];
+		} else {
+			uint8_t s = 0;
+
+			while (s < SCENE_COUNT && strcmp(argv[i], scenes[s].name)) {
+				++s;
+			}
+
+			if (s == SCENE_COUNT) {
+				usage();
+			}
+
+			selected[s] = any = true;
+		}
+	}
+
+	HostCanvas canvas(CANVAS_WIDTH, CANVAS_HEIGHT);
+	HostCanvas recorded(CANVAS_WIDTH, CANVAS_HEIGHT);
+	HostCanvas* output = &canvas;
+	AnsiDisplay ansiDisplay(stdout);
+	RecorderDisplay recorderDisplay(&recorded);
+	Display* display = NULL;
+
+	if (displayName != NULL && !strcmp(displayName, "ansi")) {
+		display = &ansiDisplay;
+	} else if (displayName != NULL && !strcmp(displayName, "record")) {
+		display = &recorderDisplay;
+		output = &recorded;
+	} else if (displayName != NULL) {
+		usage();
+	}
+
+	if (frames == 0 || scale == 0) {
+		usage();
+	}
+
+	HostCanvas::current = &canvas;
+
+	for (uint8_t s = 0; s < SCENE_COUNT; ++s) {
+		if (any && !selected[s]) {
+			continue;
+		}
+
+		if (bench > 0) {
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+			for (uint32_t i = 0; i < bench; ++i) {
+				canvas.clear();
+				hostMillis = 0;
+				scenes[s].render(&canvas, frames, false);
+			}
+
+			double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+			printf("%-8s %10.1f ns/frame\n", scenes[s].name, ns / ((double) bench * frames));
+
+			continue;
+		}
+
+		canvas.clear();
+		hostMillis = 0;
+		scenes[s].render(&canvas, frames, true);
+
+		if (display != NULL) {
+			recorded.clear();
+			presentFrames(&canvas, display, display == &ansiDisplay);
+
+			// the terminal is the only output
+			if (display == &ansiDisplay) {
+				continue;
+			}
+		}
+
+		char path[256];
+		bool written;
+
+		if (sequence) {
+			snprintf(path, sizeof(path), "%s/%s", outDir, scenes[s].name);
+			written = output->writeSequence(path, scale);
+		} else {
+			snprintf(path, sizeof(path), "%s/%s.ppm", outDir, scenes[s].name);
+			written = output->writeStrip(path, scale);
+		}
+
+		if (!written) {
+			fprintf(stderr, "cannot write %s\n", path);
+			return 1;
+		}
+
+		if (hash) {
+			printf("%-8s %08x\n", scenes[s].name, output->hash());
+		}
+	}
+
+	return 0;
+}
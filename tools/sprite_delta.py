@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+#
+# Generates sprite_delta_data.h from sprite_data.h and the animation frame
+# lists in catris.cpp. For every pair of consecutive frames (including the
+# wrap-around from the last frame to the first one) it emits a delta sprite
+# which contains only the pixels that differ between the two frames.
+#
+# Delta sprites use the same encoding as regular sprites (color, pixel count,
+# coordinates, ..., terminated by a zero pixel count). Pixels that have to be
+# turned off use the SPRITE_DELTA_CLEAR color index defined in graphics.h.
+# They are always stored in PROGMEM, whatever SPRITES_IN_PROGMEM says.
+#
+# usage: tools/sprite_delta.py > sprite_delta_data.h
+#
+
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+
+SPRITE_RE = re.compile(r'const uint8_t SPRITE_STORAGE (\w+)\[\] = \{(.*?)\};', re.S)
+FRAME_RE = re.compile(r'_(\w+)Animation->setFrame\((\d+), [^,]+, \(uint8_t\*\) (\w+)')
+NUMBER_RE = re.compile(r'\b(0b[01]+|0x[0-9a-fA-F]+|\d+)\b')
+
+CLEAR = 0xff
+
+
+def strip_comments(text):
+    return re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+
+
+def parse_number(token):
+    if token.startswith('0b'):
+        return int(token[2:], 2)
+    return int(token, 0)
+
+
+def decode_sprite(data):
+    pixels = {}
+    i = 0
+
+    while True:
+        color = data[i]
+        count = data[i + 1]
+        i += 2
+
+        if count == 0:
+            return pixels
+
+        for coords in data[i:i + count]:
+            pixels[coords] = color
+
+        i += count
+
+
+def encode_delta(frm, to):
+    groups = {}
+
+    for coords in sorted(set(frm) | set(to)):
+        color = to.get(coords, CLEAR)
+
+        if frm.get(coords, CLEAR) != color:
+            groups.setdefault(color, []).append(coords)
+
+    return [(color, groups[color]) for color in sorted(groups)]
+
+
+def delta_name(frm, to):
+    frm = frm[:-len('Sprite')]
+    to = to[:-len('Sprite')]
+
+    return '%sTo%s%sDelta' % (frm, to[0].upper(), to[1:])
+
+
+def main():
+    with open(os.path.join(ROOT, 'sprite_data.h')) as f:
+        sprite_source = strip_comments(f.read())
+
+    with open(os.path.join(ROOT, 'catris.cpp')) as f:
+        catris_source = f.read()
+
+    sprites = {}
+    for name, body in SPRITE_RE.findall(sprite_source):
+        sprites[name] = decode_sprite([parse_number(n) for n in NUMBER_RE.findall(body)])
+
+    animations = {}
+    for animation, idx, sprite in FRAME_RE.findall(catris_source):
+        animations.setdefault(animation, []).append((int(idx), sprite))
+
+    transitions = []
+    for animation in animations:
+        frames = [sprite for _, sprite in sorted(animations[animation])]
+
+        for i, sprite in enumerate(frames):
+            transition = (frames[i - 1], sprite)
+
+            if transition not in transitions:
+                transitions.append(transition)
+
+    out = sys.stdout
+
+    out.write('#ifndef __SPRITE_DELTA_DATA_H\n')
+    out.write('#define __SPRITE_DELTA_DATA_H\n\n')
+    out.write('// generated by tools/sprite_delta.py, do not edit\n')
+    out.write('// always in PROGMEM, Catris reads them with pgm_read_byte\n\n')
+    out.write('#include "graphics.h"\n')
+    out.write('#include "sprite_data.h"\n')
+
+    for frm, to in transitions:
+        out.write('\nconst uint8_t PROGMEM %s[] = {\n' % delta_name(frm, to))
+
+        for color, coords in encode_delta(sprites[frm], sprites[to]):
+            out.write('\n\t\t/* color:  */ %s,\n' % ('SPRITE_DELTA_CLEAR' if color == CLEAR else color))
+            out.write('\t\t/* pixels: */ %d,\n' % len(coords))
+            out.write('\t\t/* data:   */ %s,\n' % ', '.join('0b{:08b}'.format(c) for c in coords))
+
+        out.write('\n\t\t/* end:    */ 0b00000000, 0b00000000\n')
+        out.write('};\n')
+
+    out.write('\n#endif\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,48 @@
+#include "transition.h"
+
+Transition::Transition(uint8_t width, uint8_t height):
+		_width(width), _height(height), _effect(Blend), _frames(0), _frame(0) {
+
+	_to = (uint8_t*) malloc(width * height * 3);
+}
+
+Transition::~Transition() {
+	free(_to);
+}
+
+void Transition::begin(Effect effect, uint8_t frames) {
+	_effect = effect;
+	_frames = frames > 0 ? frames : 1;
+	_frame = 0;
+
+	// screens only draw their own areas, everything else stays black
+	fbFill(_to, _width * _height, 0, 0, 0);
+}
+
+uint8_t* Transition::getBuffer() {
+	return _to;
+}
+
+bool Transition::isRunning() {
+	return _frame < _frames;
+}
+
+bool Transition::render(blendBuffer blend) {
+	if (!isRunning()) {
+		return false;
+	}
+
+	_frame++;
+
+	if (_effect == Wipe) {
+		// top to bottom, the rows below the edge keep the outgoing screen
+		blend(_to, (uint16_t) _frame * _height / _frames * _width, 255);
+	} else {
+		// the output already moved (frame - 1) / frames of the way, covering
+		// 1 / (frames - frame + 1) of the rest keeps the blend linear, the
+		// last frame is exactly the incoming screen
+		blend(_to, _width * _height, 256 / (_frames - _frame + 1) - 1);
+	}
+
+	return true;
+}
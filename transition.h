@@ -0,0 +1,46 @@
+#ifndef __TRANSITION_H
+#define __TRANSITION_H
+
+#include <stdlib.h>
+#include <inttypes.h>
+#include <string.h>
+#include "graphics.h"
+#include "framebuffer_ops.h"
+
+// moves the first pixels of the output towards the ones in to by fraction
+// (Q8), 255 replaces them
+typedef void (*blendBuffer) (const uint8_t* to, uint16_t pixels, uint8_t fraction);
+
+// The outgoing screen is whatever the output holds when the transition
+// begins, so only the incoming screen is buffered, as r, g, b per pixel in
+// the pixel order and color space of the output. Draw it into getBuffer()
+// and render it into the output every frame until isRunning() returns false.
+class Transition {
+
+public:
+
+	enum Effect {
+		Blend,
+		Wipe
+	};
+
+	Transition(uint8_t width, uint8_t height);
+
+	~Transition();
+
+	void begin(Effect effect, uint8_t frames);
+	uint8_t* getBuffer();
+	bool isRunning();
+	bool render(blendBuffer blend);
+
+private:
+
+	uint8_t _width;
+	uint8_t _height;
+	uint8_t* _to; // incoming screen
+	Effect _effect;
+	uint8_t _frames;
+	uint8_t _frame;
+};
+
+#endif